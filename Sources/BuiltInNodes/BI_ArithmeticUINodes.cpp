@@ -1,8 +1,16 @@
 #include "BI_ArithmeticUINodes.hpp"
 #include "NE_Localization.hpp"
+#include "NE_NumberListValues.hpp"
 #include "NUIE_NodeCommonParameters.hpp"
 
 #include <cmath>
+#include <vector>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USE_SSE2
+#include <emmintrin.h>
+#endif
 
 namespace BI
 {
@@ -13,6 +21,133 @@ NE::DynamicSerializationInfo	SubtractionNode::serializationInfo (NE::ObjectId ("
 NE::DynamicSerializationInfo	MultiplicationNode::serializationInfo (NE::ObjectId ("{75F39B99-8296-4D79-8BB7-418D55F93C25}"), NE::ObjectVersion (1), MultiplicationNode::CreateSerializableInstance);
 NE::DynamicSerializationInfo	DivisionNode::serializationInfo (NE::ObjectId ("{652DDDFC-A441-40B1-87AC-0BED247F35E7}"), NE::ObjectVersion (1), DivisionNode::CreateSerializableInstance);
 
+static const NE::SlotId ASlotId ("a");
+static const NE::SlotId BSlotId ("b");
+
+class AdditionOperation
+{
+public:
+	static double Apply (double a, double b)
+	{
+		return a + b;
+	}
+
+#if defined(USE_SSE2)
+	static __m128d Apply (__m128d a, __m128d b)
+	{
+		return _mm_add_pd (a, b);
+	}
+#endif
+};
+
+class SubtractionOperation
+{
+public:
+	static double Apply (double a, double b)
+	{
+		return a - b;
+	}
+
+#if defined(USE_SSE2)
+	static __m128d Apply (__m128d a, __m128d b)
+	{
+		return _mm_sub_pd (a, b);
+	}
+#endif
+};
+
+class MultiplicationOperation
+{
+public:
+	static double Apply (double a, double b)
+	{
+		return a * b;
+	}
+
+#if defined(USE_SSE2)
+	static __m128d Apply (__m128d a, __m128d b)
+	{
+		return _mm_mul_pd (a, b);
+	}
+#endif
+};
+
+class DivisionOperation
+{
+public:
+	static double Apply (double a, double b)
+	{
+		return a / b;
+	}
+
+#if defined(USE_SSE2)
+	static __m128d Apply (__m128d a, __m128d b)
+	{
+		return _mm_div_pd (a, b);
+	}
+#endif
+};
+
+template <class Operation>
+static bool ApplyOperation (const double* aValues, size_t aStep, const double* bValues, size_t bStep, double* result, size_t count)
+{
+	bool isValid = true;
+	size_t i = 0;
+#if defined(USE_SSE2)
+	__m128d invalidMask = _mm_setzero_pd ();
+	for (; i + 2 <= count; i += 2) {
+		__m128d aPacked = (aStep == 0 ? _mm_set1_pd (aValues[0]) : _mm_loadu_pd (aValues + i));
+		__m128d bPacked = (bStep == 0 ? _mm_set1_pd (bValues[0]) : _mm_loadu_pd (bValues + i));
+		__m128d resultPacked = Operation::Apply (aPacked, bPacked);
+		__m128d difference = _mm_sub_pd (resultPacked, resultPacked);
+		invalidMask = _mm_or_pd (invalidMask, _mm_cmpunord_pd (difference, difference));
+		_mm_storeu_pd (result + i, resultPacked);
+	}
+	isValid = (_mm_movemask_pd (invalidMask) == 0);
+#endif
+	for (; i < count; i++) {
+		result[i] = Operation::Apply (aValues[i * aStep], bValues[i * bStep]);
+		if (std::isnan (result[i]) || std::isinf (result[i])) {
+			isValid = false;
+		}
+	}
+	return isValid;
+}
+
+template <class Operation>
+static bool ApplyListOperation (const double* aValues, size_t aCount, const double* bValues, size_t bCount, double* result, size_t resultCount)
+{
+	size_t commonCount = std::min (std::min (aCount, bCount), resultCount);
+	if (!ApplyOperation<Operation> (aValues, 1, bValues, 1, result, commonCount)) {
+		return false;
+	}
+	if (resultCount == commonCount) {
+		return true;
+	}
+	if (aCount < bCount) {
+		return ApplyOperation<Operation> (aValues + aCount - 1, 0, bValues + commonCount, 1, result + commonCount, resultCount - commonCount);
+	} else {
+		return ApplyOperation<Operation> (aValues + commonCount, 1, bValues + bCount - 1, 0, result + commonCount, resultCount - commonCount);
+	}
+}
+
+static bool GetOperandValues (const NE::ValueConstPtr& value, double& singleValue, const double*& values, size_t& count)
+{
+	if (NE::Value::IsType<NE::DoubleListValue> (value)) {
+		const std::vector<double>& items = NE::Value::Cast<NE::DoubleListValue> (value.get ())->GetItems ();
+		values = items.data ();
+		count = items.size ();
+		return count > 0;
+	}
+	if (NE::Value::IsType<NE::SingleValue> (value) && NE::Value::IsType<NE::NumberValue> (value)) {
+		singleValue = NE::NumberValue::ToDouble (value);
+		values = &singleValue;
+		count = 1;
+		return true;
+	}
+	return false;
+}
+
 BinaryOperationNode::BinaryOperationNode () :
 	BinaryOperationNode (std::wstring (), NUIE::Point ())
 {
@@ -39,13 +174,38 @@ void BinaryOperationNode::Initialize ()
 
 NE::ValueConstPtr BinaryOperationNode::Calculate (NE::EvaluationEnv& env) const
 {
-	NE::ValueConstPtr aValue = EvaluateInputSlot (NE::SlotId ("a"), env);
-	NE::ValueConstPtr bValue = EvaluateInputSlot (NE::SlotId ("b"), env);
+	NE::ValueConstPtr aValue = EvaluateInputSlot (ASlotId, env);
+	NE::ValueConstPtr bValue = EvaluateInputSlot (BSlotId, env);
 	if (!NE::IsComplexType<NE::NumberValue> (aValue) || !NE::IsComplexType<NE::NumberValue> (bValue)) {
 		return nullptr;
 	}
 
-	NE::ListValuePtr resultListValue (new NE::ListValue ());
+	double aSingle = 0.0;
+	double bSingle = 0.0;
+	const double* aValues = nullptr;
+	const double* bValues = nullptr;
+	size_t aCount = 0;
+	size_t bCount = 0;
+	if (GetOperandValues (aValue, aSingle, aValues, aCount) && GetOperandValues (bValue, bSingle, bValues, bCount)) {
+		NE::ValueCombinationMode combinationMode = GetValueCombinationFeature (this)->GetValueCombinationMode ();
+		std::vector<double> result;
+		if (combinationMode == NE::ValueCombinationMode::CrossProduct) {
+			result.resize (aCount * bCount);
+			for (size_t i = 0; i < aCount; i++) {
+				if (!DoListOperation (aValues + i, 1, bValues, bCount, result.data () + i * bCount, bCount)) {
+					return nullptr;
+				}
+			}
+		} else {
+			result.resize (combinationMode == NE::ValueCombinationMode::Shortest ? std::min (aCount, bCount) : std::max (aCount, bCount));
+			if (!DoListOperation (aValues, aCount, bValues, bCount, result.data (), result.size ())) {
+				return nullptr;
+			}
+		}
+		return NE::ValuePtr (new NE::DoubleListValue (std::move (result)));
+	}
+
+	NE::DoubleListValuePtr resultListValue (new NE::DoubleListValue ());
 	bool isValid = CombineValues (this, {aValue, bValue}, [&] (const NE::ValueCombination& combination) {
 		double aDouble = NE::NumberValue::ToDouble (combination.GetValue (0));
 		double bDouble = NE::NumberValue::ToDouble (combination.GetValue (1));
@@ -53,7 +213,7 @@ NE::ValueConstPtr BinaryOperationNode::Calculate (NE::EvaluationEnv& env) const
 		if (std::isnan (result) || std::isinf (result)) {
 			return false;
 		}
-		resultListValue->Push (NE::ValuePtr (new NE::DoubleValue (result)));
+		resultListValue->PushItem (result);
 		return true;
 	});
 
@@ -89,6 +249,17 @@ NE::Stream::Status BinaryOperationNode::Write (NE::OutputStream& outputStream) c
 	return outputStream.GetStatus ();
 }
 
+bool BinaryOperationNode::DoListOperation (const double* aValues, size_t aCount, const double* bValues, size_t bCount, double* result, size_t resultCount) const
+{
+	for (size_t i = 0; i < resultCount; i++) {
+		result[i] = DoOperation (aValues[std::min (i, aCount - 1)], bValues[std::min (i, bCount - 1)]);
+		if (std::isnan (result[i]) || std::isinf (result[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
 AdditionNode::AdditionNode () :
 	BinaryOperationNode ()
 {
@@ -106,11 +277,21 @@ AdditionNode::~AdditionNode ()
 
 }
 
+NE::NodePtr AdditionNode::CreateClone () const
+{
+	return NE::NodePtr (new AdditionNode (*this));
+}
+
 double AdditionNode::DoOperation (double a, double b) const
 {
 	return a + b;
 }
 
+bool AdditionNode::DoListOperation (const double* aValues, size_t aCount, const double* bValues, size_t bCount, double* result, size_t resultCount) const
+{
+	return ApplyListOperation<AdditionOperation> (aValues, aCount, bValues, bCount, result, resultCount);
+}
+
 SubtractionNode::SubtractionNode () :
 	BinaryOperationNode ()
 {
@@ -128,11 +309,21 @@ SubtractionNode::~SubtractionNode ()
 
 }
 
+NE::NodePtr SubtractionNode::CreateClone () const
+{
+	return NE::NodePtr (new SubtractionNode (*this));
+}
+
 double SubtractionNode::DoOperation (double a, double b) const
 {
 	return a - b;
 }
 
+bool SubtractionNode::DoListOperation (const double* aValues, size_t aCount, const double* bValues, size_t bCount, double* result, size_t resultCount) const
+{
+	return ApplyListOperation<SubtractionOperation> (aValues, aCount, bValues, bCount, result, resultCount);
+}
+
 MultiplicationNode::MultiplicationNode () :
 	BinaryOperationNode ()
 {
@@ -150,11 +341,21 @@ MultiplicationNode::~MultiplicationNode ()
 
 }
 
+NE::NodePtr MultiplicationNode::CreateClone () const
+{
+	return NE::NodePtr (new MultiplicationNode (*this));
+}
+
 double MultiplicationNode::DoOperation (double a, double b) const
 {
 	return a * b;
 }
 
+bool MultiplicationNode::DoListOperation (const double* aValues, size_t aCount, const double* bValues, size_t bCount, double* result, size_t resultCount) const
+{
+	return ApplyListOperation<MultiplicationOperation> (aValues, aCount, bValues, bCount, result, resultCount);
+}
+
 DivisionNode::DivisionNode () :
 	BinaryOperationNode ()
 {
@@ -172,9 +373,19 @@ DivisionNode::~DivisionNode ()
 
 }
 
+NE::NodePtr DivisionNode::CreateClone () const
+{
+	return NE::NodePtr (new DivisionNode (*this));
+}
+
 double DivisionNode::DoOperation (double a, double b) const
 {
 	return a / b;
 }
 
+bool DivisionNode::DoListOperation (const double* aValues, size_t aCount, const double* bValues, size_t bCount, double* result, size_t resultCount) const
+{
+	return ApplyListOperation<DivisionOperation> (aValues, aCount, bValues, bCount, result, resultCount);
+}
+
 }
@@ -28,6 +28,7 @@ public:
 
 private:
 	virtual double				DoOperation (double a, double b) const = 0;
+	virtual bool				DoListOperation (const double* aValues, size_t aCount, const double* bValues, size_t bCount, double* result, size_t resultCount) const;
 };
 
 class AdditionNode : public BinaryOperationNode
@@ -39,8 +40,11 @@ public:
 	AdditionNode (const std::wstring& name, const NUIE::Point& position);
 	virtual ~AdditionNode ();
 
+	virtual NE::NodePtr	CreateClone () const override;
+
 private:
-	virtual double DoOperation (double a, double b) const override;
+	virtual double	DoOperation (double a, double b) const override;
+	virtual bool	DoListOperation (const double* aValues, size_t aCount, const double* bValues, size_t bCount, double* result, size_t resultCount) const override;
 };
 
 class SubtractionNode : public BinaryOperationNode
@@ -52,8 +56,11 @@ public:
 	SubtractionNode (const std::wstring& name, const NUIE::Point& position);
 	virtual ~SubtractionNode ();
 
+	virtual NE::NodePtr	CreateClone () const override;
+
 private:
-	virtual double DoOperation (double a, double b) const override;
+	virtual double	DoOperation (double a, double b) const override;
+	virtual bool	DoListOperation (const double* aValues, size_t aCount, const double* bValues, size_t bCount, double* result, size_t resultCount) const override;
 };
 
 class MultiplicationNode : public BinaryOperationNode
@@ -65,8 +72,11 @@ public:
 	MultiplicationNode (const std::wstring& name, const NUIE::Point& position);
 	virtual ~MultiplicationNode ();
 
+	virtual NE::NodePtr	CreateClone () const override;
+
 private:
-	virtual double DoOperation (double a, double b) const override;
+	virtual double	DoOperation (double a, double b) const override;
+	virtual bool	DoListOperation (const double* aValues, size_t aCount, const double* bValues, size_t bCount, double* result, size_t resultCount) const override;
 };
 
 class DivisionNode : public BinaryOperationNode
@@ -78,8 +88,11 @@ public:
 	DivisionNode (const std::wstring& name, const NUIE::Point& position);
 	virtual ~DivisionNode ();
 
+	virtual NE::NodePtr	CreateClone () const override;
+
 private:
-	virtual double DoOperation (double a, double b) const override;
+	virtual double	DoOperation (double a, double b) const override;
+	virtual bool	DoListOperation (const double* aValues, size_t aCount, const double* bValues, size_t bCount, double* result, size_t resultCount) const override;
 };
 
 }
@@ -51,6 +51,7 @@ const NUIE::IconId& BasicUINode::GetIconId () const
 void BasicUINode::SetIconId (const NUIE::IconId& newIconId)
 {
 	iconId = newIconId;
+	InvalidateContentHash ();
 }
 
 NE::Stream::Status BasicUINode::Read (NE::InputStream& inputStream)
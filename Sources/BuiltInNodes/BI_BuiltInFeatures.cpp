@@ -11,6 +11,8 @@ namespace BI
 const NUIE::FeatureId EnableDisableFeatureId ("{A60BA8C8-ADFB-48D2-A112-ADD99F0B6CE7}");
 const NUIE::FeatureId ValueCombinationFeatureId ("{B8F03216-5CB8-49FC-B748-94479BD2C8CA}");
 
+static const size_t ParallelCombinationChunkSize = 256;
+
 NE::DynamicSerializationInfo EnableDisableFeature::serializationInfo (NE::ObjectId ("{1C89FD8B-085E-45C8-B0B8-E75883F53C68}"), NE::ObjectVersion (1), EnableDisableFeature::CreateSerializableInstance);
 NE::DynamicSerializationInfo ValueCombinationFeature::serializationInfo (NE::ObjectId ("{7BC21A4E-4D2E-4B00-BD73-9897DB3616BA}"), NE::ObjectVersion (1), ValueCombinationFeature::CreateSerializableInstance);
 
@@ -109,6 +111,11 @@ EnableDisableFeature::~EnableDisableFeature ()
 
 }
 
+NUIE::NodeFeaturePtr EnableDisableFeature::CreateClone () const
+{
+	return NUIE::NodeFeaturePtr (new EnableDisableFeature (*this));
+}
+
 EnableDisableFeature::State EnableDisableFeature::GetState () const
 {
 	return state;
@@ -210,6 +217,11 @@ ValueCombinationFeature::~ValueCombinationFeature ()
 
 }
 
+NUIE::NodeFeaturePtr ValueCombinationFeature::CreateClone () const
+{
+	return NUIE::NodeFeaturePtr (new ValueCombinationFeature (*this));
+}
+
 NE::ValueCombinationMode ValueCombinationFeature::GetValueCombinationMode () const
 {
 	return valueCombinationMode;
@@ -225,6 +237,11 @@ bool ValueCombinationFeature::CombineValues (const std::vector<NE::ValueConstPtr
 	return NE::CombineValues (valueCombinationMode, values, processor);
 }
 
+bool ValueCombinationFeature::CombineValuesParallel (const std::vector<NE::ValueConstPtr>& values, const std::function<NE::ValueConstPtr (const NE::ValueCombination&)>& processor, std::vector<NE::ValueConstPtr>& results) const
+{
+	return NE::CombineValuesParallel (valueCombinationMode, values, ParallelCombinationChunkSize, processor, results);
+}
+
 void ValueCombinationFeature::RegisterCommands (NUIE::NodeCommandRegistrator& commandRegistrator) const
 {
 	NUIE::NodeGroupCommandPtr setValueCombinationModeGroup (new NUIE::NodeGroupCommand<NUIE::NodeCommandPtr> (NE::Localize (L"Set Value Combination")));
@@ -321,4 +338,22 @@ bool CombineValues (const NUIE::UINodeConstPtr& uiNode, const std::vector<NE::Va
 	return valueCombination->CombineValues (values, processor);
 }
 
+bool CombineValuesParallel (const NUIE::UINode* uiNode, const std::vector<NE::ValueConstPtr>& values, const std::function<NE::ValueConstPtr (const NE::ValueCombination&)>& processor, std::vector<NE::ValueConstPtr>& results)
+{
+	std::shared_ptr<ValueCombinationFeature> valueCombination = GetValueCombinationFeature (uiNode);
+	if (DBGERROR (valueCombination == nullptr)) {
+		return false;
+	}
+	return valueCombination->CombineValuesParallel (values, processor, results);
+}
+
+bool CombineValuesParallel (const NUIE::UINodeConstPtr& uiNode, const std::vector<NE::ValueConstPtr>& values, const std::function<NE::ValueConstPtr (const NE::ValueCombination&)>& processor, std::vector<NE::ValueConstPtr>& results)
+{
+	std::shared_ptr<ValueCombinationFeature> valueCombination = GetValueCombinationFeature (uiNode);
+	if (DBGERROR (valueCombination == nullptr)) {
+		return false;
+	}
+	return valueCombination->CombineValuesParallel (values, processor, results);
+}
+
 }
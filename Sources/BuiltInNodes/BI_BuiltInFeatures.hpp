@@ -40,6 +40,8 @@ public:
 	virtual void		RegisterCommands (NUIE::NodeCommandRegistrator& commandRegistrator) const override;
 	virtual void		RegisterParameters (NUIE::NodeParameterList& parameterList) const override;
 
+	virtual NUIE::NodeFeaturePtr	CreateClone () const override;
+
 	virtual NE::Stream::Status	Read (NE::InputStream& inputStream) override;
 	virtual NE::Stream::Status	Write (NE::OutputStream& outputStream) const override;
 
@@ -60,10 +62,13 @@ public:
 	NE::ValueCombinationMode	GetValueCombinationMode () const;
 	void						SetValueCombinationMode (NE::ValueCombinationMode newValueCombinationMode);
 	bool						CombineValues (const std::vector<NE::ValueConstPtr>& values, const std::function<bool (const NE::ValueCombination&)>& processor) const;
+	bool						CombineValuesParallel (const std::vector<NE::ValueConstPtr>& values, const std::function<NE::ValueConstPtr (const NE::ValueCombination&)>& processor, std::vector<NE::ValueConstPtr>& results) const;
 
 	virtual void				RegisterCommands (NUIE::NodeCommandRegistrator& commandRegistrator) const override;
 	virtual void				RegisterParameters (NUIE::NodeParameterList& parameterList) const override;
 
+	virtual NUIE::NodeFeaturePtr	CreateClone () const override;
+
 	virtual NE::Stream::Status	Read (NE::InputStream& inputStream) override;
 	virtual NE::Stream::Status	Write (NE::OutputStream& outputStream) const override;
 
@@ -77,6 +82,8 @@ std::shared_ptr<ValueCombinationFeature> GetValueCombinationFeature (const NUIE:
 std::shared_ptr<ValueCombinationFeature> GetValueCombinationFeature (const NUIE::UINodeConstPtr& uiNode);
 bool CombineValues (const NUIE::UINode* uiNode, const std::vector<NE::ValueConstPtr>& values, const std::function<bool (const NE::ValueCombination&)>& processor);
 bool CombineValues (const NUIE::UINodeConstPtr& uiNode, const std::vector<NE::ValueConstPtr>& values, const std::function<bool (const NE::ValueCombination&)>& processor);
+bool CombineValuesParallel (const NUIE::UINode* uiNode, const std::vector<NE::ValueConstPtr>& values, const std::function<NE::ValueConstPtr (const NE::ValueCombination&)>& processor, std::vector<NE::ValueConstPtr>& results);
+bool CombineValuesParallel (const NUIE::UINodeConstPtr& uiNode, const std::vector<NE::ValueConstPtr>& values, const std::function<NE::ValueConstPtr (const NE::ValueCombination&)>& processor, std::vector<NE::ValueConstPtr>& results);
 
 }
 
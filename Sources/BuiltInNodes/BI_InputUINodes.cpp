@@ -1,6 +1,7 @@
 #include "BI_InputUINodes.hpp"
 #include "BI_UINodePanels.hpp"
 #include "NE_Localization.hpp"
+#include "NE_NumberListValues.hpp"
 #include "NUIE_NodeParameters.hpp"
 #include "NUIE_NodeCommonParameters.hpp"
 #include "NUIE_NodeUIManager.hpp"
@@ -25,6 +26,12 @@ NE::DynamicSerializationInfo	DoubleDistributedNode::serializationInfo (NE::Objec
 
 NE::DynamicSerializationInfo	ListBuilderNode::serializationInfo (NE::ObjectId ("{FE9C19DE-4847-458D-8F2D-5D943E7CF8AF}"), NE::ObjectVersion (1), ListBuilderNode::CreateSerializableInstance);
 
+static const NE::SlotId StartSlotId ("start");
+static const NE::SlotId StepSlotId ("step");
+static const NE::SlotId EndSlotId ("end");
+static const NE::SlotId CountSlotId ("count");
+static const NE::SlotId InSlotId ("in");
+
 template <typename NodeType>
 class MinValueIntegerParameter : public NUIE::SlotDefaultValueNodeParameter<NodeType, NE::IntValue>
 {
@@ -100,6 +107,11 @@ BooleanNode::~BooleanNode ()
 
 }
 
+NE::NodePtr BooleanNode::CreateClone () const
+{
+	return NE::NodePtr (new BooleanNode (*this));
+}
+
 void BooleanNode::Initialize ()
 {
 	RegisterUIOutputSlot (NUIE::UIOutputSlotPtr (new NUIE::UIOutputSlot (NE::SlotId ("out"), NE::Localize (L"Output"))));
@@ -112,7 +124,7 @@ bool BooleanNode::IsForceCalculated () const
 
 NE::ValueConstPtr BooleanNode::Calculate (NE::EvaluationEnv&) const
 {
-	return NE::ValueConstPtr (new NE::BooleanValue (val));
+	return NE::BooleanValue::Create (val);
 }
 
 void BooleanNode::RegisterParameters (NUIE::NodeParameterList& parameterList) const
@@ -167,6 +179,7 @@ bool BooleanNode::GetValue () const
 void BooleanNode::SetValue (bool newVal)
 {
 	val = newVal;
+	InvalidateContentHash ();
 }
 
 NumericUpDownNode::Layout::Layout (	const std::string& leftButtonId,
@@ -277,9 +290,14 @@ IntegerUpDownNode::~IntegerUpDownNode ()
 
 }
 
+NE::NodePtr IntegerUpDownNode::CreateClone () const
+{
+	return NE::NodePtr (new IntegerUpDownNode (*this));
+}
+
 NE::ValueConstPtr IntegerUpDownNode::Calculate (NE::EvaluationEnv&) const
 {
-	return NE::ValueConstPtr (new NE::IntValue (val));
+	return NE::IntValue::Create (val);
 }
 
 void IntegerUpDownNode::RegisterParameters (NUIE::NodeParameterList& parameterList) const
@@ -369,6 +387,7 @@ int IntegerUpDownNode::GetValue () const
 void IntegerUpDownNode::SetValue (int newValue)
 {
 	val = newValue;
+	InvalidateContentHash ();
 }
 
 int IntegerUpDownNode::GetStep () const
@@ -379,6 +398,7 @@ int IntegerUpDownNode::GetStep () const
 void IntegerUpDownNode::SetStep (int newStep)
 {
 	step = newStep;
+	InvalidateContentHash ();
 }
 
 DoubleUpDownNode::DoubleUpDownNode () :
@@ -400,9 +420,14 @@ DoubleUpDownNode::~DoubleUpDownNode ()
 
 }
 
+NE::NodePtr DoubleUpDownNode::CreateClone () const
+{
+	return NE::NodePtr (new DoubleUpDownNode (*this));
+}
+
 NE::ValueConstPtr DoubleUpDownNode::Calculate (NE::EvaluationEnv&) const
 {
-	return NE::ValueConstPtr (new NE::DoubleValue (val));
+	return NE::DoubleValue::Create (val);
 }
 
 void DoubleUpDownNode::RegisterParameters (NUIE::NodeParameterList& parameterList) const
@@ -492,6 +517,7 @@ double DoubleUpDownNode::GetValue () const
 void DoubleUpDownNode::SetValue (double newValue)
 {
 	val = newValue;
+	InvalidateContentHash ();
 }
 
 double DoubleUpDownNode::GetStep () const
@@ -502,6 +528,7 @@ double DoubleUpDownNode::GetStep () const
 void DoubleUpDownNode::SetStep (double newStep)
 {
 	step = newStep;
+	InvalidateContentHash ();
 }
 
 NumericRangeNode::NumericRangeNode () :
@@ -557,6 +584,11 @@ IntegerIncrementedNode::~IntegerIncrementedNode ()
 
 }
 
+NE::NodePtr IntegerIncrementedNode::CreateClone () const
+{
+	return NE::NodePtr (new IntegerIncrementedNode (*this));
+}
+
 void IntegerIncrementedNode::Initialize ()
 {
 	RegisterUIInputSlot (NUIE::UIInputSlotPtr (new NUIE::UIInputSlot (NE::SlotId ("start"), NE::Localize (L"Start"), NE::ValuePtr (new NE::IntValue (0)), NE::OutputSlotConnectionMode::Single)));
@@ -567,9 +599,9 @@ void IntegerIncrementedNode::Initialize ()
 
 NE::ValueConstPtr IntegerIncrementedNode::Calculate (NE::EvaluationEnv& env) const
 {
-	NE::ValueConstPtr start = EvaluateInputSlot (NE::SlotId ("start"), env);
-	NE::ValueConstPtr step = EvaluateInputSlot (NE::SlotId ("step"), env);
-	NE::ValueConstPtr count = EvaluateInputSlot (NE::SlotId ("count"), env);
+	NE::ValueConstPtr start = EvaluateInputSlot (StartSlotId, env);
+	NE::ValueConstPtr step = EvaluateInputSlot (StepSlotId, env);
+	NE::ValueConstPtr count = EvaluateInputSlot (CountSlotId, env);
 	if (!NE::IsSingleType<NE::NumberValue> (start) || !NE::IsSingleType<NE::NumberValue> (step) || !NE::IsSingleType<NE::NumberValue> (count)) {
 		return nullptr;
 	}
@@ -581,9 +613,10 @@ NE::ValueConstPtr IntegerIncrementedNode::Calculate (NE::EvaluationEnv& env) con
 		return nullptr;
 	}
 
-	NE::ListValuePtr list (new NE::ListValue ());
+	NE::IntListValuePtr list (new NE::IntListValue ());
+	list->Reserve (countNum);
 	for (int i = 0; i < countNum; ++i) {
-		list->Push (NE::ValuePtr (new NE::IntValue (startNum + i * stepNum)));
+		list->PushItem (startNum + i * stepNum);
 	}
 
 	return list;
@@ -628,6 +661,11 @@ DoubleIncrementedNode::~DoubleIncrementedNode ()
 
 }
 
+NE::NodePtr DoubleIncrementedNode::CreateClone () const
+{
+	return NE::NodePtr (new DoubleIncrementedNode (*this));
+}
+
 void DoubleIncrementedNode::Initialize ()
 {
 	RegisterUIInputSlot (NUIE::UIInputSlotPtr (new NUIE::UIInputSlot (NE::SlotId ("start"), NE::Localize (L"Start"), NE::ValuePtr (new NE::DoubleValue (0.0)), NE::OutputSlotConnectionMode::Single)));
@@ -638,9 +676,9 @@ void DoubleIncrementedNode::Initialize ()
 
 NE::ValueConstPtr DoubleIncrementedNode::Calculate (NE::EvaluationEnv& env) const
 {
-	NE::ValueConstPtr start = EvaluateInputSlot (NE::SlotId ("start"), env);
-	NE::ValueConstPtr step = EvaluateInputSlot (NE::SlotId ("step"), env);
-	NE::ValueConstPtr count = EvaluateInputSlot (NE::SlotId ("count"), env);
+	NE::ValueConstPtr start = EvaluateInputSlot (StartSlotId, env);
+	NE::ValueConstPtr step = EvaluateInputSlot (StepSlotId, env);
+	NE::ValueConstPtr count = EvaluateInputSlot (CountSlotId, env);
 	if (!NE::IsSingleType<NE::NumberValue> (start) || !NE::IsSingleType<NE::NumberValue> (step) || !NE::IsSingleType<NE::NumberValue> (count)) {
 		return nullptr;
 	}
@@ -652,9 +690,10 @@ NE::ValueConstPtr DoubleIncrementedNode::Calculate (NE::EvaluationEnv& env) cons
 		return nullptr;
 	}
 
-	NE::ListValuePtr list (new NE::ListValue ());
+	NE::DoubleListValuePtr list (new NE::DoubleListValue ());
+	list->Reserve (countNum);
 	for (int i = 0; i < countNum; ++i) {
-		list->Push (NE::ValuePtr (new NE::DoubleValue (startNum + i * stepNum)));
+		list->PushItem (startNum + i * stepNum);
 	}
 
 	return list;
@@ -699,6 +738,11 @@ DoubleDistributedNode::~DoubleDistributedNode ()
 
 }
 
+NE::NodePtr DoubleDistributedNode::CreateClone () const
+{
+	return NE::NodePtr (new DoubleDistributedNode (*this));
+}
+
 void DoubleDistributedNode::Initialize ()
 {
 	RegisterUIInputSlot (NUIE::UIInputSlotPtr (new NUIE::UIInputSlot (NE::SlotId ("start"), NE::Localize (L"Start"), NE::ValuePtr (new NE::DoubleValue (0.0)), NE::OutputSlotConnectionMode::Single)));
@@ -709,9 +753,9 @@ void DoubleDistributedNode::Initialize ()
 
 NE::ValueConstPtr DoubleDistributedNode::Calculate (NE::EvaluationEnv& env) const
 {
-	NE::ValueConstPtr start = EvaluateInputSlot (NE::SlotId ("start"), env);
-	NE::ValueConstPtr end = EvaluateInputSlot (NE::SlotId ("end"), env);
-	NE::ValueConstPtr count = EvaluateInputSlot (NE::SlotId ("count"), env);
+	NE::ValueConstPtr start = EvaluateInputSlot (StartSlotId, env);
+	NE::ValueConstPtr end = EvaluateInputSlot (EndSlotId, env);
+	NE::ValueConstPtr count = EvaluateInputSlot (CountSlotId, env);
 	if (!NE::IsSingleType<NE::NumberValue> (start) || !NE::IsSingleType<NE::NumberValue> (end) || !NE::IsSingleType<NE::NumberValue> (count)) {
 		return nullptr;
 	}
@@ -724,9 +768,10 @@ NE::ValueConstPtr DoubleDistributedNode::Calculate (NE::EvaluationEnv& env) cons
 	}
 
 	double segmentVal = std::fabs (startNum - endNum) / (double) (countNum - 1);
-	NE::ListValuePtr list (new NE::ListValue ());
+	NE::DoubleListValuePtr list (new NE::DoubleListValue ());
+	list->Reserve (countNum);
 	for (int i = 0; i < countNum; ++i) {
-		list->Push (NE::ValuePtr (new NE::DoubleValue (startNum + i * segmentVal)));
+		list->PushItem (startNum + i * segmentVal);
 	}
 
 	return list;
@@ -771,6 +816,11 @@ ListBuilderNode::~ListBuilderNode ()
 
 }
 
+NE::NodePtr ListBuilderNode::CreateClone () const
+{
+	return NE::NodePtr (new ListBuilderNode (*this));
+}
+
 void ListBuilderNode::Initialize ()
 {
 	RegisterUIInputSlot (NUIE::UIInputSlotPtr (new NUIE::UIInputSlot (NE::SlotId ("in"), NE::Localize (L"Input"), nullptr, NE::OutputSlotConnectionMode::Multiple)));
@@ -779,7 +829,7 @@ void ListBuilderNode::Initialize ()
 
 NE::ValueConstPtr ListBuilderNode::Calculate (NE::EvaluationEnv& env) const
 {
-	NE::ValueConstPtr in = EvaluateInputSlot (NE::SlotId ("in"), env);
+	NE::ValueConstPtr in = EvaluateInputSlot (InSlotId, env);
 	if (in == nullptr) {
 		return nullptr;
 	}
@@ -34,6 +34,8 @@ public:
 	virtual NE::ValueConstPtr			Calculate (NE::EvaluationEnv& env) const override;
 	virtual void						RegisterParameters (NUIE::NodeParameterList& parameterList) const override;
 
+	virtual NE::NodePtr					CreateClone () const override;
+
 	virtual NE::Stream::Status			Read (NE::InputStream& inputStream) override;
 	virtual NE::Stream::Status			Write (NE::OutputStream& outputStream) const override;
 
@@ -88,6 +90,8 @@ public:
 	virtual NE::ValueConstPtr			Calculate (NE::EvaluationEnv& env) const override;
 	virtual void						RegisterParameters (NUIE::NodeParameterList& parameterList) const override;
 
+	virtual NE::NodePtr					CreateClone () const override;
+
 	virtual NE::Stream::Status			Read (NE::InputStream& inputStream) override;
 	virtual NE::Stream::Status			Write (NE::OutputStream& outputStream) const override;
 
@@ -117,6 +121,8 @@ public:
 	virtual NE::ValueConstPtr			Calculate (NE::EvaluationEnv& env) const override;
 	virtual void						RegisterParameters (NUIE::NodeParameterList& parameterList) const override;
 
+	virtual NE::NodePtr					CreateClone () const override;
+
 	virtual NE::Stream::Status			Read (NE::InputStream& inputStream) override;
 	virtual NE::Stream::Status			Write (NE::OutputStream& outputStream) const override;
 
@@ -162,6 +168,8 @@ public:
 	virtual NE::ValueConstPtr	Calculate (NE::EvaluationEnv& env) const override;
 	virtual void				RegisterParameters (NUIE::NodeParameterList& parameterList) const override;
 
+	virtual NE::NodePtr			CreateClone () const override;
+
 	virtual NE::Stream::Status	Read (NE::InputStream& inputStream) override;
 	virtual NE::Stream::Status	Write (NE::OutputStream& outputStream) const override;
 };
@@ -179,6 +187,8 @@ public:
 	virtual NE::ValueConstPtr	Calculate (NE::EvaluationEnv& env) const override;
 	virtual void				RegisterParameters (NUIE::NodeParameterList& parameterList) const override;
 
+	virtual NE::NodePtr			CreateClone () const override;
+
 	virtual NE::Stream::Status	Read (NE::InputStream& inputStream) override;
 	virtual NE::Stream::Status	Write (NE::OutputStream& outputStream) const override;
 };
@@ -196,6 +206,8 @@ public:
 	virtual NE::ValueConstPtr	Calculate (NE::EvaluationEnv& env) const override;
 	virtual void				RegisterParameters (NUIE::NodeParameterList& parameterList) const override;
 
+	virtual NE::NodePtr			CreateClone () const override;
+
 	virtual NE::Stream::Status	Read (NE::InputStream& inputStream) override;
 	virtual NE::Stream::Status	Write (NE::OutputStream& outputStream) const override;
 };
@@ -212,6 +224,8 @@ public:
 	virtual void						Initialize () override;
 	virtual NE::ValueConstPtr			Calculate (NE::EvaluationEnv& env) const override;
 
+	virtual NE::NodePtr					CreateClone () const override;
+
 	virtual NE::Stream::Status			Read (NE::InputStream& inputStream) override;
 	virtual NE::Stream::Status			Write (NE::OutputStream& outputStream) const override;
 };
@@ -12,6 +12,8 @@ namespace BI
 NE::DynamicSerializationInfo ViewerNode::serializationInfo (NE::ObjectId ("{417392AA-F72D-4E84-8F58-766D0AAC07FC}"), NE::ObjectVersion (1), ViewerNode::CreateSerializableInstance);
 NE::DynamicSerializationInfo MultiLineViewerNode::serializationInfo (NE::ObjectId ("{2BACB82D-84A6-4472-82CB-786C98A50EF0}"), NE::ObjectVersion (1), MultiLineViewerNode::CreateSerializableInstance);
 
+static const NE::SlotId InSlotId ("in");
+
 ViewerNode::Layout::Layout () :
 	HeaderWithSlotsAndTextLayout ()
 {
@@ -46,6 +48,11 @@ ViewerNode::~ViewerNode ()
 
 }
 
+NE::NodePtr ViewerNode::CreateClone () const
+{
+	return NE::NodePtr (new ViewerNode (*this));
+}
+
 void ViewerNode::Initialize ()
 {
 	RegisterUIInputSlot (NUIE::UIInputSlotPtr (new NUIE::UIInputSlot (NE::SlotId ("in"), NE::Localize (L"Input"), nullptr, NE::OutputSlotConnectionMode::Single)));
@@ -59,7 +66,7 @@ bool ViewerNode::IsForceCalculated () const
 
 NE::ValueConstPtr ViewerNode::Calculate (NE::EvaluationEnv& env) const
 {
-	NE::ValueConstPtr val = EvaluateInputSlot (NE::SlotId ("in"), env);
+	NE::ValueConstPtr val = EvaluateInputSlot (InSlotId, env);
 	if (val == nullptr) {
 		return nullptr;
 	}
@@ -100,6 +107,11 @@ MultiLineViewerNode::~MultiLineViewerNode ()
 
 }
 
+NE::NodePtr MultiLineViewerNode::CreateClone () const
+{
+	return NE::NodePtr (new MultiLineViewerNode (*this));
+}
+
 void MultiLineViewerNode::Initialize ()
 {
 	RegisterUIInputSlot (NUIE::UIInputSlotPtr (new NUIE::UIInputSlot (NE::SlotId ("in"), NE::Localize (L"Input"), nullptr, NE::OutputSlotConnectionMode::Single)));
@@ -108,7 +120,7 @@ void MultiLineViewerNode::Initialize ()
 
 NE::ValueConstPtr MultiLineViewerNode::Calculate (NE::EvaluationEnv& env) const
 {
-	return EvaluateInputSlot (NE::SlotId ("in"), env);
+	return EvaluateInputSlot (InSlotId, env);
 }
 
 void MultiLineViewerNode::RegisterParameters (NUIE::NodeParameterList& parameterList) const
@@ -262,6 +274,7 @@ size_t MultiLineViewerNode::GetTextsPerPage () const
 void MultiLineViewerNode::SetTextsPerPage (size_t newTextsPerPage)
 {
 	textsPerPage = newTextsPerPage;
+	InvalidateContentHash ();
 }
 
 }
@@ -31,6 +31,8 @@ public:
 
 	virtual NE::ValueConstPtr			Calculate (NE::EvaluationEnv& env) const override;
 
+	virtual NE::NodePtr					CreateClone () const override;
+
 	virtual NE::Stream::Status			Read (NE::InputStream& inputStream) override;
 	virtual NE::Stream::Status			Write (NE::OutputStream& outputStream) const override;
 };
@@ -53,6 +55,8 @@ public:
 
 	virtual bool						IsForceCalculated () const override;
 
+	virtual NE::NodePtr					CreateClone () const override;
+
 	virtual NE::Stream::Status			Read (NE::InputStream& inputStream) override;
 	virtual NE::Stream::Status			Write (NE::OutputStream& outputStream) const override;
 
@@ -0,0 +1,222 @@
+#include "NE_Compression.hpp"
+#include "NE_Debug.hpp"
+
+#include <cstring>
+#include <cstdint>
+
+namespace NE
+{
+
+static const size_t MinMatchLength = 4;
+static const size_t MaxMatchOffset = 65535;
+static const size_t HashTableBits = 14;
+static const size_t HashTableSize = 1 << HashTableBits;
+
+static uint32_t ReadSequence (const char* data)
+{
+	uint32_t sequence = 0;
+	memcpy (&sequence, data, sizeof (sequence));
+	return sequence;
+}
+
+static size_t HashSequence (uint32_t sequence)
+{
+	return (size_t) ((sequence * 2654435761u) >> (32 - HashTableBits));
+}
+
+static void WriteVarInt (std::vector<char>& target, size_t value)
+{
+	while (value >= 0x80) {
+		target.push_back ((char) ((value & 0x7F) | 0x80));
+		value >>= 7;
+	}
+	target.push_back ((char) value);
+}
+
+static bool ReadVarInt (const std::vector<char>& source, size_t& position, size_t& value)
+{
+	value = 0;
+	for (size_t shift = 0; shift < sizeof (size_t) * 8; shift += 7) {
+		if (position >= source.size ()) {
+			return false;
+		}
+		unsigned char byte = (unsigned char) source[position++];
+		value |= (size_t) (byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static void WriteLiterals (std::vector<char>& target, const char* literals, size_t literalCount)
+{
+	WriteVarInt (target, literalCount);
+	target.insert (target.end (), literals, literals + literalCount);
+}
+
+void CompressData (const std::vector<char>& source, std::vector<char>& target)
+{
+	target.clear ();
+	target.reserve (source.size () / 2 + 16);
+	WriteVarInt (target, source.size ());
+
+	const char* data = source.data ();
+	size_t size = source.size ();
+	std::vector<size_t> hashTable (HashTableSize, 0);
+
+	size_t literalStart = 0;
+	size_t position = 0;
+	while (position + MinMatchLength <= size) {
+		uint32_t sequence = ReadSequence (data + position);
+		size_t hash = HashSequence (sequence);
+		size_t candidate = hashTable[hash];
+		hashTable[hash] = position + 1;
+		if (candidate == 0 || position - (candidate - 1) > MaxMatchOffset || ReadSequence (data + candidate - 1) != sequence) {
+			position++;
+			continue;
+		}
+
+		size_t matchStart = candidate - 1;
+		size_t matchLength = MinMatchLength;
+		while (position + matchLength < size && data[matchStart + matchLength] == data[position + matchLength]) {
+			matchLength++;
+		}
+
+		WriteLiterals (target, data + literalStart, position - literalStart);
+		WriteVarInt (target, matchLength - MinMatchLength);
+		WriteVarInt (target, position - matchStart);
+		position += matchLength;
+		literalStart = position;
+	}
+
+	WriteLiterals (target, data + literalStart, size - literalStart);
+}
+
+static bool ReadMatch (const std::vector<char>& source, size_t& position, size_t targetSize, size_t size, size_t& matchLength, size_t& matchOffset)
+{
+	if (!ReadVarInt (source, position, matchLength) || !ReadVarInt (source, position, matchOffset)) {
+		return false;
+	}
+	if (matchLength > size - targetSize || size - targetSize - matchLength < MinMatchLength) {
+		return false;
+	}
+	matchLength += MinMatchLength;
+	if (matchOffset == 0 || matchOffset > targetSize) {
+		return false;
+	}
+	return true;
+}
+
+static bool IsValidCompressedData (const std::vector<char>& source, size_t position, size_t size)
+{
+	size_t targetSize = 0;
+	while (true) {
+		size_t literalCount = 0;
+		if (!ReadVarInt (source, position, literalCount)) {
+			return false;
+		}
+		if (literalCount > source.size () - position || literalCount > size - targetSize) {
+			return false;
+		}
+		position += literalCount;
+		targetSize += literalCount;
+		if (targetSize == size) {
+			break;
+		}
+
+		size_t matchLength = 0;
+		size_t matchOffset = 0;
+		if (!ReadMatch (source, position, targetSize, size, matchLength, matchOffset)) {
+			return false;
+		}
+		targetSize += matchLength;
+	}
+	return position == source.size ();
+}
+
+bool DecompressData (const std::vector<char>& source, std::vector<char>& target)
+{
+	target.clear ();
+
+	size_t position = 0;
+	size_t size = 0;
+	if (!ReadVarInt (source, position, size)) {
+		return false;
+	}
+	if (size > target.max_size () || !IsValidCompressedData (source, position, size)) {
+		return false;
+	}
+	target.reserve (size);
+
+	while (target.size () < size) {
+		size_t literalCount = 0;
+		DBGVERIFY (ReadVarInt (source, position, literalCount));
+		target.insert (target.end (), source.begin () + position, source.begin () + position + literalCount);
+		position += literalCount;
+		if (target.size () == size) {
+			break;
+		}
+
+		size_t matchLength = 0;
+		size_t matchOffset = 0;
+		DBGVERIFY (ReadMatch (source, position, target.size (), size, matchLength, matchOffset));
+		size_t matchStart = target.size () - matchOffset;
+		for (size_t i = 0; i < matchLength; i++) {
+			target.push_back (target[matchStart + i]);
+		}
+	}
+
+	return true;
+}
+
+CompressedBuffer::CompressedBuffer () :
+	buffer (),
+	isCompressed (false)
+{
+
+}
+
+CompressedBuffer::~CompressedBuffer ()
+{
+
+}
+
+void CompressedBuffer::Set (const std::vector<char>& data, CompressionMode compression)
+{
+	isCompressed = false;
+	if (compression == CompressionMode::LZ) {
+		std::vector<char> compressedData;
+		CompressData (data, compressedData);
+		if (compressedData.size () < data.size ()) {
+			std::vector<char> (compressedData.begin (), compressedData.end ()).swap (buffer);
+			isCompressed = true;
+			return;
+		}
+	}
+	std::vector<char> (data.begin (), data.end ()).swap (buffer);
+}
+
+bool CompressedBuffer::Get (std::vector<char>& data) const
+{
+	if (!isCompressed) {
+		data = buffer;
+		return true;
+	}
+	if (DBGERROR (!DecompressData (buffer, data))) {
+		return false;
+	}
+	return true;
+}
+
+size_t CompressedBuffer::GetSize () const
+{
+	return buffer.capacity ();
+}
+
+bool CompressedBuffer::IsCompressed () const
+{
+	return isCompressed;
+}
+
+}
@@ -0,0 +1,37 @@
+#ifndef NE_COMPRESSION_HPP
+#define NE_COMPRESSION_HPP
+
+#include <vector>
+#include <cstddef>
+
+namespace NE
+{
+
+enum class CompressionMode
+{
+	None,
+	LZ
+};
+
+void	CompressData (const std::vector<char>& source, std::vector<char>& target);
+bool	DecompressData (const std::vector<char>& source, std::vector<char>& target);
+
+class CompressedBuffer
+{
+public:
+	CompressedBuffer ();
+	~CompressedBuffer ();
+
+	void	Set (const std::vector<char>& data, CompressionMode compression);
+	bool	Get (std::vector<char>& data) const;
+	size_t	GetSize () const;
+	bool	IsCompressed () const;
+
+private:
+	std::vector<char>	buffer;
+	bool				isCompressed;
+};
+
+}
+
+#endif
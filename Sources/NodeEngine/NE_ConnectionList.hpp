@@ -16,17 +16,18 @@ class ConnectionList
 public:
 	ConnectionList ();
 
-	void	Clear ();
-	bool	IsEmpty () const;
-	size_t	GetConnectionCount () const;
-	size_t	GetConnectionCount (const BegSlotType& begSlot) const;
+	void				Clear ();
+	bool				IsEmpty () const;
+	size_t				GetConnectionCount () const;
+	size_t				GetConnectionCount (const BegSlotType& begSlot) const;
 
-	bool	HasConnection (const BegSlotType& begSlot) const;
-	bool	HasConnection (const BegSlotType& begSlot, const EndSlotType& endSlot) const;
-	void	EnumerateConnections (const BegSlotType& begSlot, const std::function<void (const EndSlotType&)>& processor) const;
+	bool				HasConnection (const BegSlotType& begSlot) const;
+	bool				HasConnection (const BegSlotType& begSlot, const EndSlotType& endSlot) const;
+	const EndSlotType&	GetSingleConnection (const BegSlotType& begSlot) const;
+	void				EnumerateConnections (const BegSlotType& begSlot, const std::function<void (const EndSlotType&)>& processor) const;
 
-	void	AddConnection (const BegSlotType& begSlot, const EndSlotType& endSlot);
-	void	DeleteConnection (const BegSlotType& begSlot, const EndSlotType& endSlot);
+	void				AddConnection (const BegSlotType& begSlot, const EndSlotType& endSlot);
+	void				DeleteConnection (const BegSlotType& begSlot, const EndSlotType& endSlot);
 
 private:
 	std::unordered_map<BegSlotType, std::vector<EndSlotType>> connections;
@@ -92,6 +93,19 @@ bool ConnectionList<BegSlotType, EndSlotType>::HasConnection (const BegSlotType&
 	return std::find (endSlots.begin (), endSlots.end (), endSlot) != endSlots.end ();
 }
 
+template <class BegSlotType, class EndSlotType>
+const EndSlotType& ConnectionList<BegSlotType, EndSlotType>::GetSingleConnection (const BegSlotType& begSlot) const
+{
+	static const EndSlotType noConnection = nullptr;
+	auto foundEndSlots = connections.find (begSlot);
+	if (foundEndSlots == connections.end ()) {
+		return noConnection;
+	}
+	const std::vector<EndSlotType>& endSlots = foundEndSlots->second;
+	DBGASSERT (endSlots.size () == 1);
+	return endSlots.front ();
+}
+
 template <class BegSlotType, class EndSlotType>
 void ConnectionList<BegSlotType, EndSlotType>::EnumerateConnections (const BegSlotType& begSlot, const std::function<void (const EndSlotType&)>& processor) const
 {
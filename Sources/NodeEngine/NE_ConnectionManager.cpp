@@ -49,6 +49,12 @@ size_t ConnectionManager::GetConnectedInputSlotCount (const OutputSlotConstPtr&
 	return outputToInputConnections.GetConnectionCount (outputSlot);
 }
 
+const OutputSlotConstPtr& ConnectionManager::GetConnectedOutputSlot (const InputSlotConstPtr& inputSlot) const
+{
+	DBGASSERT (inputSlot->GetOutputSlotConnectionMode () == OutputSlotConnectionMode::Single);
+	return inputToOutputConnections.GetSingleConnection (inputSlot);
+}
+
 void ConnectionManager::EnumerateConnectedOutputSlots (const InputSlotConstPtr& inputSlot, const std::function<void (const OutputSlotConstPtr&)>& processor) const
 {
 	inputToOutputConnections.EnumerateConnections (inputSlot, processor);
@@ -15,27 +15,29 @@ class ConnectionManager
 public:
 	ConnectionManager ();
 
-	void	Clear ();
-	bool	IsEmpty () const;
-	size_t	GetConnectionCount () const;
+	void						Clear ();
+	bool						IsEmpty () const;
+	size_t						GetConnectionCount () const;
 
-	bool	HasConnectedOutputSlots (const InputSlotConstPtr& inputSlot) const;
-	bool	HasConnectedInputSlots (const OutputSlotConstPtr& outputSlot) const;
+	bool						HasConnectedOutputSlots (const InputSlotConstPtr& inputSlot) const;
+	bool						HasConnectedInputSlots (const OutputSlotConstPtr& outputSlot) const;
 
-	size_t	GetConnectedOutputSlotCount (const InputSlotConstPtr& inputSlot) const;
-	size_t	GetConnectedInputSlotCount (const OutputSlotConstPtr& outputSlot) const;
+	size_t						GetConnectedOutputSlotCount (const InputSlotConstPtr& inputSlot) const;
+	size_t						GetConnectedInputSlotCount (const OutputSlotConstPtr& outputSlot) const;
 
-	void	EnumerateConnectedOutputSlots (const InputSlotConstPtr& inputSlot, const std::function<void (const OutputSlotConstPtr&)>& processor) const;
-	void	EnumerateConnectedInputSlots (const OutputSlotConstPtr& outputSlot, const std::function<void (const InputSlotConstPtr&)>& processor) const;
+	const OutputSlotConstPtr&	GetConnectedOutputSlot (const InputSlotConstPtr& inputSlot) const;
 
-	bool	IsOutputSlotConnectedToInputSlot (const OutputSlotConstPtr& outputSlot, const InputSlotConstPtr& inputSlot) const;
-	bool	CanConnectMoreOutputSlotToInputSlot (const InputSlotConstPtr& inputSlot) const;
-	bool	CanConnectOutputSlotToInputSlot (const OutputSlotConstPtr& outputSlot, const InputSlotConstPtr& inputSlot) const;
-	bool	ConnectOutputSlotToInputSlot (const OutputSlotConstPtr& outputSlot, const InputSlotConstPtr& inputSlot);
+	void						EnumerateConnectedOutputSlots (const InputSlotConstPtr& inputSlot, const std::function<void (const OutputSlotConstPtr&)>& processor) const;
+	void						EnumerateConnectedInputSlots (const OutputSlotConstPtr& outputSlot, const std::function<void (const InputSlotConstPtr&)>& processor) const;
+
+	bool						IsOutputSlotConnectedToInputSlot (const OutputSlotConstPtr& outputSlot, const InputSlotConstPtr& inputSlot) const;
+	bool						CanConnectMoreOutputSlotToInputSlot (const InputSlotConstPtr& inputSlot) const;
+	bool						CanConnectOutputSlotToInputSlot (const OutputSlotConstPtr& outputSlot, const InputSlotConstPtr& inputSlot) const;
+	bool						ConnectOutputSlotToInputSlot (const OutputSlotConstPtr& outputSlot, const InputSlotConstPtr& inputSlot);
 	
-	bool	DisconnectOutputSlotFromInputSlot (const OutputSlotConstPtr& outputSlot, const InputSlotConstPtr& inputSlot);
-	bool	DisconnectAllOutputSlotsFromInputSlot (const InputSlotConstPtr& inputSlot);
-	bool	DisconnectAllInputSlotsFromOutputSlot (const OutputSlotConstPtr& outputSlot);
+	bool						DisconnectOutputSlotFromInputSlot (const OutputSlotConstPtr& outputSlot, const InputSlotConstPtr& inputSlot);
+	bool						DisconnectAllOutputSlotsFromInputSlot (const InputSlotConstPtr& inputSlot);
+	bool						DisconnectAllInputSlotsFromOutputSlot (const OutputSlotConstPtr& outputSlot);
 
 private:
 	ConnectionList<OutputSlotConstPtr, InputSlotConstPtr>	outputToInputConnections;
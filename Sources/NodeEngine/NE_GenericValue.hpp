@@ -2,6 +2,7 @@
 #define NE_VALUEBASE_HPP
 
 #include "NE_Value.hpp"
+#include "NE_Debug.hpp"
 #include <vector>
 #include <functional>
 
@@ -58,19 +59,22 @@ const Type& GenericValue<Type>::GetValue () const
 template <class Type>
 const Type& GenericValue<Type>::Get (const ValueConstPtr& val)
 {
-	return Value::Cast<GenericValue<Type>> (val.get ())->GetValue ();
+	DBGASSERT (Value::IsType<GenericValue<Type>> (val));
+	return static_cast<const GenericValue<Type>*> (val.get ())->GetValue ();
 }
 
 template <class Type>
 const Type& GenericValue<Type>::Get (const ValuePtr& val)
 {
-	return Value::Cast<GenericValue<Type>> (val.get ())->GetValue ();
+	DBGASSERT (Value::IsType<GenericValue<Type>> (val));
+	return static_cast<const GenericValue<Type>*> (val.get ())->GetValue ();
 }
 
 template <class Type>
 const Type& GenericValue<Type>::Get (Value* val)
 {
-	return Value::Cast<GenericValue<Type>> (val)->GetValue ();
+	DBGASSERT (Value::IsType<GenericValue<Type>> (val));
+	return static_cast<const GenericValue<Type>*> (val)->GetValue ();
 }
 
 }
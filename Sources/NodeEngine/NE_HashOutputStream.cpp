@@ -0,0 +1,118 @@
+#include "NE_HashOutputStream.hpp"
+
+namespace NE
+{
+
+static const uint64_t FNVOffsetBasis = 14695981039346656037ull;
+static const uint64_t FNVPrime = 1099511628211ull;
+
+HashOutputStream::HashOutputStream () :
+	OutputStream (),
+	hashValue (FNVOffsetBasis),
+	size (0)
+{
+
+}
+
+HashOutputStream::~HashOutputStream ()
+{
+
+}
+
+uint64_t HashOutputStream::GetHashValue () const
+{
+	uint64_t result = hashValue;
+	result ^= (uint64_t) size;
+	result *= FNVPrime;
+	return result;
+}
+
+size_t HashOutputStream::GetSize () const
+{
+	return size;
+}
+
+Stream::Status HashOutputStream::Write (const bool& val)
+{
+	Write ((const char*) &val, sizeof (val));
+	return GetStatus ();
+}
+
+Stream::Status HashOutputStream::Write (const char& val)
+{
+	Write ((const char*) &val, sizeof (val));
+	return GetStatus ();
+}
+
+Stream::Status HashOutputStream::Write (const unsigned char& val)
+{
+	Write ((const char*) &val, sizeof (val));
+	return GetStatus ();
+}
+
+Stream::Status HashOutputStream::Write (const short& val)
+{
+	Write ((const char*) &val, sizeof (val));
+	return GetStatus ();
+}
+
+Stream::Status HashOutputStream::Write (const size_t& val)
+{
+	Write ((const char*) &val, sizeof (val));
+	return GetStatus ();
+}
+
+Stream::Status HashOutputStream::Write (const int& val)
+{
+	Write ((const char*) &val, sizeof (val));
+	return GetStatus ();
+}
+
+Stream::Status HashOutputStream::Write (const float& val)
+{
+	Write ((const char*) &val, sizeof (val));
+	return GetStatus ();
+}
+
+Stream::Status HashOutputStream::Write (const double& val)
+{
+	Write ((const char*) &val, sizeof (val));
+	return GetStatus ();
+}
+
+Stream::Status HashOutputStream::Write (const std::string& val)
+{
+	Write (val.length ());
+	Write ((const char*) val.c_str (), val.length () * sizeof (char));
+	return GetStatus ();
+}
+
+Stream::Status HashOutputStream::Write (const std::wstring& val)
+{
+	Write (val.length ());
+	Write ((const char*) val.c_str (), val.length () * sizeof (wchar_t));
+	return GetStatus ();
+}
+
+Stream::Status HashOutputStream::WriteArray (const int* vals, size_t count)
+{
+	Write ((const char*) vals, count * sizeof (int));
+	return GetStatus ();
+}
+
+Stream::Status HashOutputStream::WriteArray (const double* vals, size_t count)
+{
+	Write ((const char*) vals, count * sizeof (double));
+	return GetStatus ();
+}
+
+void HashOutputStream::Write (const char* source, size_t sourceSize)
+{
+	for (size_t i = 0; i < sourceSize; i++) {
+		hashValue ^= (uint64_t) (unsigned char) source[i];
+		hashValue *= FNVPrime;
+	}
+	size += sourceSize;
+}
+
+}
@@ -0,0 +1,45 @@
+#ifndef NE_HASHOUTPUTSTREAM_HPP
+#define NE_HASHOUTPUTSTREAM_HPP
+
+#include "NE_Stream.hpp"
+
+#include <cstdint>
+
+namespace NE
+{
+
+// Calculates a hash value of the written data without storing it.
+
+class HashOutputStream : public OutputStream
+{
+public:
+	HashOutputStream ();
+	virtual ~HashOutputStream ();
+
+	uint64_t		GetHashValue () const;
+	size_t			GetSize () const;
+
+	virtual Status	Write (const bool& val) override;
+	virtual Status	Write (const char& val) override;
+	virtual Status	Write (const unsigned char& val) override;
+	virtual Status	Write (const short& val) override;
+	virtual Status	Write (const size_t& val) override;
+	virtual Status	Write (const int& val) override;
+	virtual Status	Write (const float& val) override;
+	virtual Status	Write (const double& val) override;
+	virtual Status	Write (const std::string& val) override;
+	virtual Status	Write (const std::wstring& val) override;
+
+	virtual Status	WriteArray (const int* vals, size_t count) override;
+	virtual Status	WriteArray (const double* vals, size_t count) override;
+
+	void			Write (const char* source, size_t sourceSize);
+
+private:
+	uint64_t		hashValue;
+	size_t			size;
+};
+
+}
+
+#endif
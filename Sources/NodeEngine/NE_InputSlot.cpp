@@ -47,6 +47,16 @@ void InputSlot::SetDefaultValue (const ValueConstPtr& newDefaultValue)
 	}
 }
 
+InputSlotPtr InputSlot::CreateClone () const
+{
+	return InputSlotPtr (new InputSlot (*this));
+}
+
+InputSlotPtr InputSlot::Clone (const InputSlotConstPtr& inputSlot)
+{
+	return CloneDynamicObject (inputSlot);
+}
+
 Stream::Status InputSlot::Read (InputStream& inputStream)
 {
 	ObjectHeader header (inputStream);
@@ -26,6 +26,9 @@ public:
 	OutputSlotConnectionMode	GetOutputSlotConnectionMode () const;
 	ValueConstPtr				GetDefaultValue () const;
 	void						SetDefaultValue (const ValueConstPtr& newDefaultValue);
+
+	virtual InputSlotPtr		CreateClone () const;
+	static InputSlotPtr			Clone (const InputSlotConstPtr& inputSlot);
 	
 	virtual Stream::Status		Read (InputStream& inputStream) override;
 	virtual Stream::Status		Write (OutputStream& outputStream) const override;
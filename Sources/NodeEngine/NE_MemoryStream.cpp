@@ -1,9 +1,36 @@
 #include "NE_MemoryStream.hpp"
 #include "NE_Debug.hpp"
 
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <locale>
+#include <codecvt>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 namespace NE
 {
 
+static const size_t MaxVarIntSize = (sizeof (size_t) * 8 + 6) / 7;
+
+static size_t EncodeZigZag (int val)
+{
+	unsigned int unsignedVal = (unsigned int) val;
+	return (size_t) ((unsignedVal << 1) ^ (val < 0 ? ~0u : 0u));
+}
+
+static int DecodeZigZag (size_t val)
+{
+	unsigned int unsignedVal = (unsigned int) val;
+	return (int) ((unsignedVal >> 1) ^ (0u - (unsignedVal & 1u)));
+}
+
 template <typename CharType, typename StringType>
 Stream::Status ReadString (MemoryInputStream& stream, StringType& val)
 {
@@ -12,12 +39,13 @@ Stream::Status ReadString (MemoryInputStream& stream, StringType& val)
 		return stream.GetStatus ();
 	}
 
-	CharType* str = new CharType[count + 1];
-	stream.Read ((char*) str, count * sizeof (CharType));
-	str[count] = 0;
-
-	val = str;
-	delete[] str;
+	StringType str (count, 0);
+	if (count > 0) {
+		stream.Read ((char*) &str[0], count * sizeof (CharType));
+	}
+	if (stream.GetStatus () == Stream::Status::NoError) {
+		val = std::move (str);
+	}
 
 	return stream.GetStatus ();
 }
@@ -31,7 +59,14 @@ Stream::Status WriteString (MemoryOutputStream& stream, const StringType& val)
 }
 
 MemoryInputStream::MemoryInputStream (const std::vector<char>& buffer) :
+	MemoryInputStream (buffer.data (), buffer.size ())
+{
+	
+}
+
+MemoryInputStream::MemoryInputStream (const char* buffer, size_t bufferSize) :
 	buffer (buffer),
+	bufferSize (bufferSize),
 	position (0)
 {
 	
@@ -68,12 +103,22 @@ Stream::Status MemoryInputStream::Read (short& val)
 
 Stream::Status MemoryInputStream::Read (size_t& val)
 {
+	if (format == Format::Compact) {
+		return ReadVarInt (val);
+	}
 	Read ((char*) &val, sizeof (val));
 	return GetStatus ();
 }
 
 Stream::Status MemoryInputStream::Read (int& val)
 {
+	if (format == Format::Compact) {
+		size_t encodedVal = 0;
+		if (ReadVarInt (encodedVal) == Status::NoError) {
+			val = DecodeZigZag (encodedVal);
+		}
+		return GetStatus ();
+	}
 	Read ((char*) &val, sizeof (val));
 	return GetStatus ();
 }
@@ -100,20 +145,116 @@ Stream::Status MemoryInputStream::Read (std::wstring& val)
 	return ReadString<wchar_t, std::wstring> (*this, val);
 }
 
+Stream::Status MemoryInputStream::ReadVarInt (size_t& val)
+{
+	val = 0;
+	for (size_t i = 0; i < MaxVarIntSize; i++) {
+		unsigned char byte = 0;
+		if (Read (byte) != Status::NoError) {
+			return status;
+		}
+		val |= (size_t) (byte & 0x7F) << (7 * i);
+		if ((byte & 0x80) == 0) {
+			return status;
+		}
+	}
+	DBGBREAK ();
+	status = Status::Error;
+	return status;
+}
+
+Stream::Status MemoryInputStream::ReadArray (int* vals, size_t count)
+{
+	if (format == Format::Compact) {
+		return InputStream::ReadArray (vals, count);
+	}
+	Read ((char*) vals, count * sizeof (int));
+	return GetStatus ();
+}
+
+Stream::Status MemoryInputStream::ReadArray (double* vals, size_t count)
+{
+	Read ((char*) vals, count * sizeof (double));
+	return GetStatus ();
+}
+
 void MemoryInputStream::Read (char* dest, size_t size)
 {
 	if (status != Status::NoError) {
 		return;
 	}
 
-	for (size_t i = 0; i < size; i++) {
-		if (DBGERROR (position >= buffer.size ())) {
-			status = Status::Error;
-			return;
+	if (DBGERROR (size > bufferSize - position)) {
+		status = Status::Error;
+		return;
+	}
+
+	if (size > 0) {
+		memcpy (dest, buffer + position, size);
+		position += size;
+	}
+}
+
+void MemoryInputStream::SetBuffer (const char* newBuffer, size_t newBufferSize)
+{
+	buffer = newBuffer;
+	bufferSize = newBufferSize;
+	position = 0;
+}
+
+MappedFileInputStream::MappedFileInputStream (const std::wstring& fileName) :
+	MemoryInputStream (nullptr, 0),
+	mappedData (nullptr),
+	mappedSize (0)
+{
+#ifdef _WIN32
+	HANDLE file = CreateFileW (fileName.c_str (), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) {
+		status = Status::Error;
+		return;
+	}
+	LARGE_INTEGER fileSize;
+	if (GetFileSizeEx (file, &fileSize) && fileSize.QuadPart > 0) {
+		HANDLE mapping = CreateFileMappingW (file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (mapping != NULL) {
+			mappedData = MapViewOfFile (mapping, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle (mapping);
+		}
+		if (mappedData != nullptr) {
+			mappedSize = (size_t) fileSize.QuadPart;
 		}
-		dest[i] = buffer[position];
-		position++;
 	}
+	CloseHandle (file);
+#else
+	std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
+	int file = open (converter.to_bytes (fileName).c_str (), O_RDONLY);
+	if (file == -1) {
+		status = Status::Error;
+		return;
+	}
+	struct stat fileStat;
+	if (fstat (file, &fileStat) == 0 && fileStat.st_size > 0) {
+		void* data = mmap (nullptr, (size_t) fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+		if (data != MAP_FAILED) {
+			mappedData = data;
+			mappedSize = (size_t) fileStat.st_size;
+		}
+	}
+	close (file);
+#endif
+	SetBuffer ((const char*) mappedData, mappedSize);
+}
+
+MappedFileInputStream::~MappedFileInputStream ()
+{
+	if (mappedData == nullptr) {
+		return;
+	}
+#ifdef _WIN32
+	UnmapViewOfFile (mappedData);
+#else
+	munmap (mappedData, mappedSize);
+#endif
 }
 
 MemoryOutputStream::MemoryOutputStream ()
@@ -131,6 +272,16 @@ const std::vector<char>& MemoryOutputStream::GetBuffer () const
 	return buffer;
 }
 
+size_t MemoryOutputStream::GetSize () const
+{
+	return buffer.size ();
+}
+
+void MemoryOutputStream::Reserve (size_t size)
+{
+	buffer.reserve (size);
+}
+
 Stream::Status MemoryOutputStream::Write (const bool& val)
 {
 	Write ((const char*) &val, sizeof (val));
@@ -157,12 +308,18 @@ Stream::Status MemoryOutputStream::Write (const short& val)
 
 Stream::Status MemoryOutputStream::Write (const size_t& val)
 {
+	if (format == Format::Compact) {
+		return WriteVarInt (val);
+	}
 	Write ((const char*) &val, sizeof (val));
 	return GetStatus ();
 }
 
 Stream::Status MemoryOutputStream::Write (const int& val)
 {
+	if (format == Format::Compact) {
+		return WriteVarInt (EncodeZigZag (val));
+	}
 	Write ((const char*) &val, sizeof (val));
 	return GetStatus ();
 }
@@ -189,14 +346,43 @@ Stream::Status MemoryOutputStream::Write (const std::wstring& val)
 	return WriteString<wchar_t, std::wstring> (*this, val);
 }
 
+Stream::Status MemoryOutputStream::WriteVarInt (size_t val)
+{
+	unsigned char bytes[MaxVarIntSize];
+	size_t byteCount = 0;
+	do {
+		bytes[byteCount] = (unsigned char) (val & 0x7F);
+		val >>= 7;
+		if (val != 0) {
+			bytes[byteCount] |= 0x80;
+		}
+		byteCount++;
+	} while (val != 0);
+	Write ((const char*) bytes, byteCount);
+	return status;
+}
+
+Stream::Status MemoryOutputStream::WriteArray (const int* vals, size_t count)
+{
+	if (format == Format::Compact) {
+		return OutputStream::WriteArray (vals, count);
+	}
+	Write ((const char*) vals, count * sizeof (int));
+	return GetStatus ();
+}
+
+Stream::Status MemoryOutputStream::WriteArray (const double* vals, size_t count)
+{
+	Write ((const char*) vals, count * sizeof (double));
+	return GetStatus ();
+}
+
 void MemoryOutputStream::Write (const char* source, size_t size)
 {
 	if (status != Status::NoError) {
 		return;
 	}
-	for (size_t i = 0; i < size; i++) {
-		buffer.push_back (source[i]);
-	}
+	buffer.insert (buffer.end (), source, source + size);
 }
 
 }
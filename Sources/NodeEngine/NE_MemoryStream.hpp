@@ -7,12 +7,19 @@
 namespace NE
 {
 
+// The input stream does not copy the buffer, so the buffer must outlive it.
+
 class MemoryInputStream : public InputStream
 {
 public:
 	MemoryInputStream (const std::vector<char>& buffer);
+	MemoryInputStream (std::vector<char>&& buffer) = delete;
+	MemoryInputStream (const char* buffer, size_t bufferSize);
+	MemoryInputStream (const MemoryInputStream& src) = delete;
 	virtual ~MemoryInputStream ();
 
+	MemoryInputStream&	operator= (const MemoryInputStream& rhs) = delete;
+
 	virtual Status		Read (bool& val) override;
 	virtual Status		Read (char& val) override;
 	virtual Status		Read (unsigned char& val) override;
@@ -23,14 +30,34 @@ public:
 	virtual Status		Read (double& val) override;
 	virtual Status		Read (std::string& val) override;
 	virtual Status		Read (std::wstring& val) override;
-	
+
+	virtual Status		ReadArray (int* vals, size_t count) override;
+	virtual Status		ReadArray (double* vals, size_t count) override;
+
 	void				Read (char* dest, size_t size);
 
+protected:
+	void				SetBuffer (const char* newBuffer, size_t newBufferSize);
+
 private:
-	std::vector<char>	buffer;
+	Status				ReadVarInt (size_t& val);
+
+	const char*			buffer;
+	size_t				bufferSize;
 	size_t				position;
 };
 
+class MappedFileInputStream : public MemoryInputStream
+{
+public:
+	MappedFileInputStream (const std::wstring& fileName);
+	virtual ~MappedFileInputStream ();
+
+private:
+	void*				mappedData;
+	size_t				mappedSize;
+};
+
 class MemoryOutputStream : public OutputStream
 {
 public:
@@ -38,6 +65,8 @@ public:
 	virtual ~MemoryOutputStream ();
 
 	const std::vector<char>&	GetBuffer () const;
+	size_t						GetSize () const;
+	void						Reserve (size_t size);
 
 	virtual Status				Write (const bool& val) override;
 	virtual Status				Write (const char& val) override;
@@ -50,9 +79,14 @@ public:
 	virtual Status				Write (const std::string& val) override;
 	virtual Status				Write (const std::wstring& val) override;
 
+	virtual Status				WriteArray (const int* vals, size_t count) override;
+	virtual Status				WriteArray (const double* vals, size_t count) override;
+
 	void						Write (const char* source, size_t size);
 
 private:
+	Status						WriteVarInt (size_t val);
+
 	std::vector<char>			buffer;
 };
 
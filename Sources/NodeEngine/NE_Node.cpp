@@ -3,12 +3,15 @@
 #include "NE_OutputSlot.hpp"
 #include "NE_Debug.hpp"
 #include "NE_MemoryStream.hpp"
+#include "NE_HashOutputStream.hpp"
 
 namespace NE
 {
 
 SerializationInfo Node::serializationInfo (ObjectVersion (1));
 
+static const uint64_t NoContentHash = 0;
+
 NodeEvaluator::NodeEvaluator ()
 {
 
@@ -31,11 +34,36 @@ NodeEvaluatorSetter::~NodeEvaluatorSetter ()
 
 Node::Node () :
 	nodeId (NullNodeId),
-	nodeEvaluator (nullptr)
+	nodeEvaluator (nullptr),
+	contentHash (NoContentHash)
 {
 
 }
 
+Node::Node (const Node& src) :
+	DynamicSerializable (),
+	nodeId (src.nodeId),
+	nodeEvaluator (nullptr),
+	contentHash (src.contentHash.load (std::memory_order_acquire)),
+	inputSlots (),
+	outputSlots ()
+{
+	src.inputSlots.Enumerate ([&] (const InputSlotConstPtr& inputSlot) {
+		InputSlotPtr clonedInputSlot = InputSlot::Clone (inputSlot);
+		if (DBGVERIFY (clonedInputSlot != nullptr)) {
+			Node::RegisterInputSlot (clonedInputSlot);
+		}
+		return true;
+	});
+	src.outputSlots.Enumerate ([&] (const OutputSlotConstPtr& outputSlot) {
+		OutputSlotPtr clonedOutputSlot = OutputSlot::Clone (outputSlot);
+		if (DBGVERIFY (clonedOutputSlot != nullptr)) {
+			Node::RegisterOutputSlot (clonedOutputSlot);
+		}
+		return true;
+	});
+}
+
 Node::~Node ()
 {
 
@@ -156,9 +184,15 @@ void Node::InvalidateValue () const
 	if (DBGERROR (nodeEvaluator == nullptr)) {
 		return;
 	}
+	InvalidateContentHash ();
 	nodeEvaluator->InvalidateNodeValue (GetId ());	
 }
 
+bool Node::IsThreadSafe () const
+{
+	return true;
+}
+
 Stream::Status Node::Read (InputStream& inputStream)
 {
 	if (DBGERROR (!IsEmpty ())) {
@@ -211,7 +245,7 @@ Stream::Status Node::Write (OutputStream& outputStream) const
 
 NE::ValueConstPtr Node::GetInputSlotDefaultValue (const SlotId& slotId) const
 {
-	InputSlotConstPtr inputSlot = inputSlots.Get (slotId);
+	const InputSlotConstPtr& inputSlot = inputSlots.Get (slotId);
 	if (DBGERROR (inputSlot == nullptr)) {
 		return nullptr;
 	}
@@ -225,6 +259,31 @@ void Node::SetInputSlotDefaultValue (const SlotId& slotId, const ValueConstPtr&
 		return;
 	}
 	inputSlot->SetDefaultValue (newDefaultValue);
+	InvalidateContentHash ();
+}
+
+uint64_t Node::GetContentHash () const
+{
+	uint64_t hashValue = contentHash.load (std::memory_order_acquire);
+	if (hashValue != NoContentHash) {
+		return hashValue;
+	}
+
+	HashOutputStream outputStream;
+	outputStream.SetFormat (Stream::Format::Compact);
+	Write (outputStream);
+	hashValue = outputStream.GetHashValue ();
+	if (hashValue == NoContentHash) {
+		hashValue = NoContentHash + 1;
+	}
+
+	contentHash.store (hashValue, std::memory_order_release);
+	return hashValue;
+}
+
+void Node::InvalidateContentHash () const
+{
+	contentHash.store (NoContentHash, std::memory_order_release);
 }
 
 void Node::SetNodeEvaluator (const NodeEvaluatorSetter& evaluatorSetter)
@@ -234,6 +293,7 @@ void Node::SetNodeEvaluator (const NodeEvaluatorSetter& evaluatorSetter)
 	if (evaluatorSetter.GetInitializationMode () == InitializationMode::Initialize) {
 		Initialize ();
 	}
+	InvalidateContentHash ();
 }
 
 bool Node::HasNodeEvaluator () const
@@ -245,6 +305,7 @@ void Node::ClearNodeEvaluator ()
 {
 	nodeId = NullNodeId;
 	nodeEvaluator = nullptr;
+	InvalidateContentHash ();
 }
 
 bool Node::RegisterInputSlot (const InputSlotPtr& newInputSlot)
@@ -275,11 +336,7 @@ bool Node::RegisterOutputSlot (const OutputSlotPtr& newOutputSlot)
 
 ValueConstPtr Node::EvaluateInputSlot (const SlotId& slotId, EvaluationEnv& env) const
 {
-	if (DBGERROR (!HasInputSlot (slotId))) {
-		return nullptr;
-	}
-
-	InputSlotConstPtr inputSlot = GetInputSlot (slotId);
+	const InputSlotConstPtr& inputSlot = inputSlots.Get (slotId);
 	if (DBGERROR (inputSlot == nullptr)) {
 		return nullptr;
 	}
@@ -303,24 +360,24 @@ ValueConstPtr Node::EvaluateInputSlot (const InputSlotConstPtr& inputSlot, Evalu
 		return nullptr;
 	}
 
+	OutputSlotConnectionMode outputSlotConnectionMode = inputSlot->GetOutputSlotConnectionMode ();
+	if (outputSlotConnectionMode == OutputSlotConnectionMode::Single) {
+		const OutputSlotConstPtr& outputSlot = nodeEvaluator->GetConnectedOutputSlot (inputSlot);
+		if (outputSlot == nullptr) {
+			return inputSlot->GetDefaultValue ();
+		}
+		return outputSlot->Evaluate (env);
+	}
+
 	if (!nodeEvaluator->HasConnectedOutputSlots (inputSlot)) {
 		return inputSlot->GetDefaultValue ();
 	}
 
-	std::vector<OutputSlotConstPtr> connectedOutputSlots;
-	nodeEvaluator->EnumerateConnectedOutputSlots (inputSlot, [&] (const OutputSlotConstPtr& outputSlot) {
-		connectedOutputSlots.push_back (outputSlot);
-	});
-
-	OutputSlotConnectionMode outputSlotConnectionMode = inputSlot->GetOutputSlotConnectionMode ();
-	if (outputSlotConnectionMode == OutputSlotConnectionMode::Single) {
-		DBGASSERT (connectedOutputSlots.size () == 1);
-		return connectedOutputSlots[0]->Evaluate (env);
-	} else if (inputSlot->GetOutputSlotConnectionMode () == OutputSlotConnectionMode::Multiple) {
+	if (outputSlotConnectionMode == OutputSlotConnectionMode::Multiple) {
 		ListValuePtr result (new ListValue ());
-		for (const OutputSlotConstPtr& outputSlot : connectedOutputSlots) {
+		nodeEvaluator->EnumerateConnectedOutputSlots (inputSlot, [&] (const OutputSlotConstPtr& outputSlot) {
 			result->Push (outputSlot->Evaluate (env));
-		}
+		});
 		return result;
 	}
 
@@ -328,32 +385,40 @@ ValueConstPtr Node::EvaluateInputSlot (const InputSlotConstPtr& inputSlot, Evalu
 	return nullptr;
 }
 
-NodePtr Node::Clone (const NodeConstPtr& node)
+#ifdef DEBUG
+static bool IsEqualSerializedNode (const NodeConstPtr& aNode, const NodeConstPtr& bNode)
 {
-	MemoryOutputStream outputStream;
-	WriteDynamicObject (outputStream, node.get ());
-	if (DBGERROR (node->Write (outputStream) != Stream::Status::NoError)) {
-		return nullptr;
-	}
+	MemoryOutputStream aStream;
+	MemoryOutputStream bStream;
+	aStream.SetFormat (Stream::Format::Compact);
+	bStream.SetFormat (Stream::Format::Compact);
+
+	aNode->Write (aStream);
+	bNode->Write (bStream);
 
-	MemoryInputStream inputStream (outputStream.GetBuffer ());
-	NodePtr result (ReadDynamicObject<Node> (inputStream));
+	return aStream.GetBuffer () == bStream.GetBuffer ();
+}
+#endif
+
+NodePtr Node::CreateClone () const
+{
+	return nullptr;
+}
+
+NodePtr Node::Clone (const NodeConstPtr& node)
+{
+	NodePtr result = CloneDynamicObject (node);
 	if (DBGERROR (result == nullptr)) {
 		return nullptr;
 	}
-
 	return result;
 }
 
 bool Node::IsEqual (const NodeConstPtr& aNode, const NodeConstPtr& bNode)
 {
-	MemoryOutputStream aStream;
-	MemoryOutputStream bStream;
-
-	aNode->Write (aStream);
-	bNode->Write (bStream);
-
-	return aStream.GetBuffer () == bStream.GetBuffer ();
+	bool isEqual = aNode->GetContentHash () == bNode->GetContentHash ();
+	DBGASSERT (isEqual == IsEqualSerializedNode (aNode, bNode));
+	return isEqual;
 }
 
 template <>
@@ -12,6 +12,8 @@
 #include <memory>
 #include <functional>
 #include <unordered_set>
+#include <atomic>
+#include <cstdint>
 
 namespace NE
 {
@@ -22,14 +24,15 @@ public:
 	NodeEvaluator ();
 	virtual ~NodeEvaluator ();
 
-	virtual void			InvalidateNodeValue (const NodeId& nodeId) const = 0;
-	virtual bool			HasConnectedOutputSlots (const InputSlotConstPtr& inputSlot) const = 0;
-	virtual void			EnumerateConnectedOutputSlots (const InputSlotConstPtr& inputSlot, const std::function<void (const OutputSlotConstPtr&)>& processor) const = 0;
+	virtual void						InvalidateNodeValue (const NodeId& nodeId) const = 0;
+	virtual bool						HasConnectedOutputSlots (const InputSlotConstPtr& inputSlot) const = 0;
+	virtual const OutputSlotConstPtr&	GetConnectedOutputSlot (const InputSlotConstPtr& inputSlot) const = 0;
+	virtual void						EnumerateConnectedOutputSlots (const InputSlotConstPtr& inputSlot, const std::function<void (const OutputSlotConstPtr&)>& processor) const = 0;
 
-	virtual bool			IsCalculationEnabled () const = 0;
-	virtual bool			HasCalculatedNodeValue (const NodeId& nodeId) const = 0;
-	virtual ValueConstPtr	GetCalculatedNodeValue (const NodeId& nodeId) const = 0;
-	virtual void			SetCalculatedNodeValue (const NodeId& nodeId, const ValueConstPtr& valuePtr) const = 0;
+	virtual bool						IsCalculationEnabled () const = 0;
+	virtual bool						HasCalculatedNodeValue (const NodeId& nodeId) const = 0;
+	virtual ValueConstPtr				GetCalculatedNodeValue (const NodeId& nodeId) const = 0;
+	virtual void						SetCalculatedNodeValue (const NodeId& nodeId, const ValueConstPtr& valuePtr) const = 0;
 };
 
 enum class InitializationMode
@@ -49,6 +52,11 @@ public:
 	virtual InitializationMode				GetInitializationMode () const = 0;
 };
 
+// Nodes cache a 64-bit hash of their serialized content, and IsEqual compares
+// only these hashes. Derived classes must call InvalidateContentHash from every
+// function that modifies data written by Write, otherwise a changed node is
+// reported as unchanged. Debug builds verify the hashes against the data.
+
 class Node : public DynamicSerializable
 {
 	SERIALIZABLE;
@@ -62,7 +70,6 @@ public:
 	};
 
 	Node ();
-	Node (const Node& src) = delete;
 	virtual ~Node ();
 
 	bool					IsEmpty () const;
@@ -85,6 +92,7 @@ public:
 	bool					HasCalculatedValue () const;
 	CalculationStatus		GetCalculationStatus () const;
 	void					InvalidateValue () const;
+	virtual bool			IsThreadSafe () const;
 
 	virtual Stream::Status	Read (InputStream& inputStream) override;
 	virtual Stream::Status	Write (OutputStream& outputStream) const override;
@@ -92,10 +100,14 @@ public:
 	ValueConstPtr			GetInputSlotDefaultValue (const SlotId& slotId) const;
 	void					SetInputSlotDefaultValue (const SlotId& slotId, const ValueConstPtr& newDefaultValue);
 
+	uint64_t				GetContentHash () const;
+	void					InvalidateContentHash () const;
+
 	void					SetNodeEvaluator (const NodeEvaluatorSetter& evaluatorSetter);
 	bool					HasNodeEvaluator () const;
 	void					ClearNodeEvaluator ();
 
+	virtual NodePtr			CreateClone () const;
 	static NodePtr			Clone (const NodeConstPtr& node);
 	static bool				IsEqual (const NodeConstPtr& aNode, const NodeConstPtr& bNode);
 
@@ -121,6 +133,8 @@ public:
 	static std::shared_ptr<const Type> CastConst (const NodeConstPtr& node);
 
 protected:
+	Node (const Node& src);
+
 	virtual bool			RegisterInputSlot (const InputSlotPtr& newInputSlot);
 	virtual bool			RegisterOutputSlot (const OutputSlotPtr& newOutputSlot);
 	ValueConstPtr			EvaluateInputSlot (const SlotId& slotId, EvaluationEnv& env) const;
@@ -134,11 +148,12 @@ private:
 
 	ValueConstPtr			EvaluateInputSlot (const InputSlotConstPtr& inputSlot, EvaluationEnv& env) const;
 
-	NodeId					nodeId;
-	NodeEvaluatorConstPtr	nodeEvaluator;
+	NodeId							nodeId;
+	NodeEvaluatorConstPtr			nodeEvaluator;
+	mutable std::atomic<uint64_t>	contentHash;
 
-	SlotList<InputSlot>		inputSlots;
-	SlotList<OutputSlot>	outputSlots;
+	SlotList<InputSlot>				inputSlots;
+	SlotList<OutputSlot>			outputSlots;
 };
 
 template <class Type>
@@ -1,6 +1,7 @@
 #ifndef NE_UTILITIES_HPP
 #define NE_UTILITIES_HPP
 
+#include <cstddef>
 #include <functional>
 #include <vector>
 
@@ -0,0 +1,233 @@
+#include "NE_NodeEvaluationPlan.hpp"
+#include "NE_NodeManager.hpp"
+#include "NE_InputSlot.hpp"
+#include "NE_OutputSlot.hpp"
+#include "NE_Debug.hpp"
+
+#include <algorithm>
+
+namespace NE
+{
+
+static NodeIndexRange GetIndexRange (const std::vector<size_t>& offsets, const std::vector<size_t>& indices, size_t index)
+{
+	if (DBGERROR (index + 1 >= offsets.size ())) {
+		return NodeIndexRange (nullptr, nullptr);
+	}
+	const size_t* data = indices.data ();
+	return NodeIndexRange (data + offsets[index], data + offsets[index + 1]);
+}
+
+static void InsertIndex (std::vector<size_t>& offsets, std::vector<size_t>& indices, size_t index, size_t value)
+{
+	indices.insert (indices.begin () + offsets[index + 1], value);
+	for (size_t i = index + 1; i < offsets.size (); i++) {
+		offsets[i] += 1;
+	}
+}
+
+NodeIndexRange::NodeIndexRange (const size_t* first, const size_t* last) :
+	first (first),
+	last (last)
+{
+
+}
+
+const size_t* NodeIndexRange::begin () const
+{
+	return first;
+}
+
+const size_t* NodeIndexRange::end () const
+{
+	return last;
+}
+
+size_t NodeIndexRange::size () const
+{
+	return last - first;
+}
+
+bool NodeIndexRange::empty () const
+{
+	return first == last;
+}
+
+NodeEvaluationPlan::NodeEvaluationPlan () :
+	isValid (false),
+	nodes (),
+	nodeIdToIndex (),
+	upstreamOffsets (),
+	upstreamIndices (),
+	downstreamOffsets (),
+	downstreamIndices ()
+{
+
+}
+
+NodeEvaluationPlan::~NodeEvaluationPlan ()
+{
+
+}
+
+bool NodeEvaluationPlan::IsValid () const
+{
+	return isValid;
+}
+
+void NodeEvaluationPlan::Invalidate ()
+{
+	isValid = false;
+	nodes.clear ();
+	nodeIdToIndex.clear ();
+	upstreamOffsets.clear ();
+	upstreamIndices.clear ();
+	downstreamOffsets.clear ();
+	downstreamIndices.clear ();
+}
+
+void NodeEvaluationPlan::Build (const NodeManager& nodeManager)
+{
+	Invalidate ();
+
+	std::vector<NodeConstPtr> unorderedNodes;
+	std::unordered_map<NodeId, size_t> unorderedNodeIdToIndex;
+	nodeManager.EnumerateNodes ([&] (const NodeConstPtr& node) {
+		unorderedNodeIdToIndex.insert ({ node->GetId (), unorderedNodes.size () });
+		unorderedNodes.push_back (node);
+		return true;
+	});
+
+	size_t nodeCount = unorderedNodes.size ();
+	std::vector<std::vector<size_t>> unorderedUpstreamNodes (nodeCount);
+	std::vector<std::vector<size_t>> unorderedDownstreamNodes (nodeCount);
+	for (size_t nodeIndex = 0; nodeIndex < nodeCount; nodeIndex++) {
+		std::vector<size_t>& upstream = unorderedUpstreamNodes[nodeIndex];
+		unorderedNodes[nodeIndex]->EnumerateInputSlots ([&] (const InputSlotConstPtr& inputSlot) {
+			nodeManager.EnumerateConnectedOutputSlots (inputSlot, [&] (const OutputSlotConstPtr& outputSlot) {
+				auto foundNode = unorderedNodeIdToIndex.find (outputSlot->GetOwnerNodeId ());
+				if (DBGVERIFY (foundNode != unorderedNodeIdToIndex.end ())) {
+					upstream.push_back (foundNode->second);
+				}
+			});
+			return true;
+		});
+		std::sort (upstream.begin (), upstream.end ());
+		upstream.erase (std::unique (upstream.begin (), upstream.end ()), upstream.end ());
+		for (size_t upstreamIndex : upstream) {
+			unorderedDownstreamNodes[upstreamIndex].push_back (nodeIndex);
+		}
+	}
+
+	std::vector<size_t> order;
+	std::vector<size_t> remainingDependencies (nodeCount);
+	order.reserve (nodeCount);
+	for (size_t nodeIndex = 0; nodeIndex < nodeCount; nodeIndex++) {
+		remainingDependencies[nodeIndex] = unorderedUpstreamNodes[nodeIndex].size ();
+		if (remainingDependencies[nodeIndex] == 0) {
+			order.push_back (nodeIndex);
+		}
+	}
+	for (size_t orderIndex = 0; orderIndex < order.size (); orderIndex++) {
+		for (size_t downstreamIndex : unorderedDownstreamNodes[order[orderIndex]]) {
+			if (--remainingDependencies[downstreamIndex] == 0) {
+				order.push_back (downstreamIndex);
+			}
+		}
+	}
+	if (DBGERROR (order.size () != nodeCount)) {
+		for (size_t nodeIndex = 0; nodeIndex < nodeCount; nodeIndex++) {
+			if (remainingDependencies[nodeIndex] != 0) {
+				order.push_back (nodeIndex);
+			}
+		}
+	}
+
+	std::vector<size_t> orderedIndices (nodeCount);
+	for (size_t orderIndex = 0; orderIndex < nodeCount; orderIndex++) {
+		orderedIndices[order[orderIndex]] = orderIndex;
+	}
+
+	nodes.reserve (nodeCount);
+	upstreamOffsets.reserve (nodeCount + 1);
+	downstreamOffsets.reserve (nodeCount + 1);
+	upstreamOffsets.push_back (0);
+	downstreamOffsets.push_back (0);
+	for (size_t orderIndex = 0; orderIndex < nodeCount; orderIndex++) {
+		size_t nodeIndex = order[orderIndex];
+		nodes.push_back (unorderedNodes[nodeIndex]);
+		nodeIdToIndex.insert ({ unorderedNodes[nodeIndex]->GetId (), orderIndex });
+		for (size_t upstreamIndex : unorderedUpstreamNodes[nodeIndex]) {
+			upstreamIndices.push_back (orderedIndices[upstreamIndex]);
+		}
+		for (size_t downstreamIndex : unorderedDownstreamNodes[nodeIndex]) {
+			downstreamIndices.push_back (orderedIndices[downstreamIndex]);
+		}
+		upstreamOffsets.push_back (upstreamIndices.size ());
+		downstreamOffsets.push_back (downstreamIndices.size ());
+	}
+
+	isValid = true;
+}
+
+bool NodeEvaluationPlan::AddDependency (const NodeId& upstreamNodeId, const NodeId& downstreamNodeId)
+{
+	if (!isValid) {
+		return false;
+	}
+
+	auto foundUpstreamNode = nodeIdToIndex.find (upstreamNodeId);
+	auto foundDownstreamNode = nodeIdToIndex.find (downstreamNodeId);
+	if (DBGERROR (foundUpstreamNode == nodeIdToIndex.end () || foundDownstreamNode == nodeIdToIndex.end ())) {
+		return false;
+	}
+
+	size_t upstreamIndex = foundUpstreamNode->second;
+	size_t downstreamIndex = foundDownstreamNode->second;
+	if (upstreamIndex >= downstreamIndex) {
+		return false;
+	}
+
+	NodeIndexRange upstream = GetUpstreamNodes (downstreamIndex);
+	if (std::find (upstream.begin (), upstream.end (), upstreamIndex) == upstream.end ()) {
+		InsertIndex (upstreamOffsets, upstreamIndices, downstreamIndex, upstreamIndex);
+		InsertIndex (downstreamOffsets, downstreamIndices, upstreamIndex, downstreamIndex);
+	}
+	return true;
+}
+
+size_t NodeEvaluationPlan::GetNodeCount () const
+{
+	return nodes.size ();
+}
+
+bool NodeEvaluationPlan::ContainsNode (const NodeId& nodeId) const
+{
+	return nodeIdToIndex.find (nodeId) != nodeIdToIndex.end ();
+}
+
+size_t NodeEvaluationPlan::GetNodeIndex (const NodeId& nodeId) const
+{
+	auto foundNode = nodeIdToIndex.find (nodeId);
+	if (DBGERROR (foundNode == nodeIdToIndex.end ())) {
+		return nodes.size ();
+	}
+	return foundNode->second;
+}
+
+const NodeConstPtr& NodeEvaluationPlan::GetNode (size_t index) const
+{
+	return nodes[index];
+}
+
+NodeIndexRange NodeEvaluationPlan::GetUpstreamNodes (size_t index) const
+{
+	return GetIndexRange (upstreamOffsets, upstreamIndices, index);
+}
+
+NodeIndexRange NodeEvaluationPlan::GetDownstreamNodes (size_t index) const
+{
+	return GetIndexRange (downstreamOffsets, downstreamIndices, index);
+}
+
+}
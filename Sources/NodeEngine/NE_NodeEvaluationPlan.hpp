@@ -0,0 +1,60 @@
+#ifndef NE_NODEEVALUATIONPLAN_HPP
+#define NE_NODEEVALUATIONPLAN_HPP
+
+#include "NE_NodeId.hpp"
+#include "NE_Node.hpp"
+
+#include <vector>
+#include <unordered_map>
+
+namespace NE
+{
+
+class NodeManager;
+
+class NodeIndexRange
+{
+public:
+	NodeIndexRange (const size_t* first, const size_t* last);
+
+	const size_t*	begin () const;
+	const size_t*	end () const;
+	size_t			size () const;
+	bool			empty () const;
+
+private:
+	const size_t*	first;
+	const size_t*	last;
+};
+
+class NodeEvaluationPlan
+{
+public:
+	NodeEvaluationPlan ();
+	~NodeEvaluationPlan ();
+
+	bool						IsValid () const;
+	void						Invalidate ();
+	void						Build (const NodeManager& nodeManager);
+	bool						AddDependency (const NodeId& upstreamNodeId, const NodeId& downstreamNodeId);
+
+	size_t						GetNodeCount () const;
+	bool						ContainsNode (const NodeId& nodeId) const;
+	size_t						GetNodeIndex (const NodeId& nodeId) const;
+	const NodeConstPtr&			GetNode (size_t index) const;
+	NodeIndexRange				GetUpstreamNodes (size_t index) const;
+	NodeIndexRange				GetDownstreamNodes (size_t index) const;
+
+private:
+	bool								isValid;
+	std::vector<NodeConstPtr>			nodes;
+	std::unordered_map<NodeId, size_t>	nodeIdToIndex;
+	std::vector<size_t>					upstreamOffsets;
+	std::vector<size_t>					upstreamIndices;
+	std::vector<size_t>					downstreamOffsets;
+	std::vector<size_t>					downstreamIndices;
+};
+
+}
+
+#endif
@@ -1,5 +1,4 @@
 #include "NE_NodeGroup.hpp"
-#include "NE_MemoryStream.hpp"
 
 namespace NE
 {
@@ -28,20 +27,17 @@ Stream::Status NodeGroup::Write (OutputStream& outputStream) const
 	return outputStream.GetStatus ();
 }
 
-NodeGroupPtr NodeGroup::Clone (const NodeGroupConstPtr& node)
+NodeGroupPtr NodeGroup::CreateClone () const
 {
-	MemoryOutputStream outputStream;
-	WriteDynamicObject (outputStream, node.get ());
-	if (DBGERROR (node->Write (outputStream) != Stream::Status::NoError)) {
-		return nullptr;
-	}
+	return nullptr;
+}
 
-	MemoryInputStream inputStream (outputStream.GetBuffer ());
-	NodeGroupPtr result (ReadDynamicObject<NodeGroup> (inputStream));
+NodeGroupPtr NodeGroup::Clone (const NodeGroupConstPtr& node)
+{
+	NodeGroupPtr result = CloneDynamicObject (node);
 	if (DBGERROR (result == nullptr)) {
 		return nullptr;
 	}
-
 	return result;
 }
 
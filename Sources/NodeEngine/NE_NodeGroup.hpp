@@ -22,6 +22,7 @@ public:
 	virtual Stream::Status	Read (InputStream& inputStream) override;
 	virtual Stream::Status	Write (OutputStream& outputStream) const override;
 
+	virtual NodeGroupPtr	CreateClone () const;
 	static NodeGroupPtr		Clone (const NodeGroupConstPtr& node);
 };
 
@@ -23,6 +23,16 @@ NodeIdType NodeIdGenerator::GenerateUniqueId ()
 	return newId;
 }
 
+NodeIdType NodeIdGenerator::GetNextUniqueId () const
+{
+	return nextId;
+}
+
+void NodeIdGenerator::SetNextUniqueId (NodeIdType newNextId)
+{
+	nextId = newNextId;
+}
+
 Stream::Status NodeIdGenerator::Read (InputStream& inputStream)
 {
 	ObjectHeader header (inputStream);
@@ -20,6 +20,8 @@ public:
 	~NodeIdGenerator ();
 
 	NodeIdType		GenerateUniqueId ();
+	NodeIdType		GetNextUniqueId () const;
+	void			SetNextUniqueId (NodeIdType newNextId);
 
 	Stream::Status	Read (InputStream& inputStream);
 	Stream::Status	Write (OutputStream& outputStream) const;
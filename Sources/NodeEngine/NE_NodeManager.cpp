@@ -4,13 +4,23 @@
 #include "NE_Debug.hpp"
 #include "NE_InputSlot.hpp"
 #include "NE_OutputSlot.hpp"
-#include "NE_MemoryStream.hpp"
+#include "NE_ThreadPool.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <algorithm>
+#include <exception>
 
 namespace NE
 {
 
 SerializationInfo NodeManager::serializationInfo (ObjectVersion (1));
 
+static const size_t EstimatedFixedNodeSize = 512;
+static const size_t EstimatedCompactNodeSize = 128;
+
 class NodeManagerNodeEvaluator : public NodeEvaluator
 {
 public:
@@ -31,6 +41,11 @@ public:
 		return nodeManager.HasConnectedOutputSlots (inputSlot);
 	}
 
+	virtual const OutputSlotConstPtr& GetConnectedOutputSlot (const InputSlotConstPtr& inputSlot) const override
+	{
+		return nodeManager.GetConnectedOutputSlot (inputSlot);
+	}
+
 	virtual void EnumerateConnectedOutputSlots (const InputSlotConstPtr& inputSlot, const std::function<void (const OutputSlotConstPtr&)>& processor) const override
 	{
 		return nodeManager.EnumerateConnectedOutputSlots (inputSlot, processor);
@@ -93,13 +108,136 @@ private:
 	InitializationMode				initMode;
 };
 
+class ParallelNodeEvaluator : public std::enable_shared_from_this<ParallelNodeEvaluator>
+{
+public:
+	ParallelNodeEvaluator (ThreadPool& threadPool, EvaluationEnv& env, const NodeEvaluationPlan& plan, const std::vector<size_t>& nodeIndices) :
+		threadPool (threadPool),
+		env (env),
+		plan (plan),
+		nodeIndices (nodeIndices),
+		planIndexToNodeIndex (),
+		remainingDependencies (nodeIndices.size ()),
+		remainingNodeCount (nodeIndices.size ()),
+		callingThreadMutex (),
+		callingThreadCondition (),
+		callingThreadNodes (),
+		hasFailed (false),
+		exception ()
+	{
+		for (size_t nodeIndex = 0; nodeIndex < nodeIndices.size (); nodeIndex++) {
+			planIndexToNodeIndex.insert ({ nodeIndices[nodeIndex], nodeIndex });
+		}
+		for (size_t nodeIndex = 0; nodeIndex < nodeIndices.size (); nodeIndex++) {
+			size_t dependencyCount = 0;
+			for (size_t upstreamPlanIndex : plan.GetUpstreamNodes (nodeIndices[nodeIndex])) {
+				if (planIndexToNodeIndex.find (upstreamPlanIndex) != planIndexToNodeIndex.end ()) {
+					dependencyCount += 1;
+				}
+			}
+			remainingDependencies[nodeIndex] = dependencyCount;
+		}
+	}
+
+	void Run ()
+	{
+		std::vector<size_t> independentNodes;
+		for (size_t nodeIndex = 0; nodeIndex < nodeIndices.size (); nodeIndex++) {
+			if (remainingDependencies[nodeIndex] == 0) {
+				independentNodes.push_back (nodeIndex);
+			}
+		}
+		for (size_t nodeIndex : independentNodes) {
+			Schedule (nodeIndex);
+		}
+		while (true) {
+			size_t nodeIndex = 0;
+			{
+				std::unique_lock<std::mutex> lock (callingThreadMutex);
+				callingThreadCondition.wait (lock, [&] () {
+					return !callingThreadNodes.empty () || remainingNodeCount == 0;
+				});
+				if (callingThreadNodes.empty ()) {
+					break;
+				}
+				nodeIndex = callingThreadNodes.front ();
+				callingThreadNodes.pop_front ();
+			}
+			EvaluateNode (nodeIndex);
+		}
+		if (exception != nullptr) {
+			std::rethrow_exception (exception);
+		}
+	}
+
+private:
+	void Schedule (size_t nodeIndex)
+	{
+		if (plan.GetNode (nodeIndices[nodeIndex])->IsThreadSafe ()) {
+			std::shared_ptr<ParallelNodeEvaluator> self = shared_from_this ();
+			threadPool.Submit ([self, nodeIndex] () {
+				self->EvaluateNode (nodeIndex);
+			});
+		} else {
+			std::lock_guard<std::mutex> lock (callingThreadMutex);
+			callingThreadNodes.push_back (nodeIndex);
+			callingThreadCondition.notify_all ();
+		}
+	}
+
+	void EvaluateNode (size_t nodeIndex)
+	{
+		if (!hasFailed) {
+			try {
+				plan.GetNode (nodeIndices[nodeIndex])->Evaluate (env);
+			} catch (...) {
+				std::lock_guard<std::mutex> lock (callingThreadMutex);
+				if (exception == nullptr) {
+					exception = std::current_exception ();
+				}
+				hasFailed = true;
+			}
+		}
+		for (size_t downstreamPlanIndex : plan.GetDownstreamNodes (nodeIndices[nodeIndex])) {
+			auto foundNode = planIndexToNodeIndex.find (downstreamPlanIndex);
+			if (foundNode == planIndexToNodeIndex.end ()) {
+				continue;
+			}
+			if (--remainingDependencies[foundNode->second] == 0) {
+				Schedule (foundNode->second);
+			}
+		}
+		std::lock_guard<std::mutex> lock (callingThreadMutex);
+		if (--remainingNodeCount == 0) {
+			callingThreadCondition.notify_all ();
+		}
+	}
+
+	ThreadPool&								threadPool;
+	EvaluationEnv&							env;
+	const NodeEvaluationPlan&				plan;
+	const std::vector<size_t>&				nodeIndices;
+	std::unordered_map<size_t, size_t>		planIndexToNodeIndex;
+	std::vector<std::atomic<size_t>>		remainingDependencies;
+	size_t									remainingNodeCount;
+	std::mutex								callingThreadMutex;
+	std::condition_variable					callingThreadCondition;
+	std::deque<size_t>						callingThreadNodes;
+	std::atomic<bool>						hasFailed;
+	std::exception_ptr						exception;
+};
+
 NodeManager::NodeManager () :
 	idGenerator (),
-	nodeIdToNodeTable (),
+	nodeList (),
+	nodeIdToIndex (),
 	connectionManager (),
 	nodeGroupList (),
 	updateMode (UpdateMode::Automatic),
+	evaluationMode (EvaluationMode::Serial),
 	nodeValueCache (),
+	evaluationPlan (),
+	invalidatedNodes (),
 	nodeEvaluator (new NodeManagerNodeEvaluator (*this, nodeValueCache)),
 	isForceCalculate (false)
 {
@@ -113,21 +251,24 @@ NodeManager::~NodeManager ()
 
 void NodeManager::Clear ()
 {
-	nodeIdToNodeTable.clear ();
+	nodeList.clear ();
+	nodeIdToIndex.clear ();
 	connectionManager.Clear ();
 	nodeGroupList.Clear ();
 	nodeValueCache.Clear ();
+	evaluationPlan.Invalidate ();
+	invalidatedNodes.clear ();
 	updateMode = UpdateMode::Automatic;
 }
 
 bool NodeManager::IsEmpty () const
 {
-	return nodeIdToNodeTable.empty () && connectionManager.IsEmpty ();
+	return nodeList.empty () && connectionManager.IsEmpty ();
 }
 
 size_t NodeManager::GetNodeCount () const
 {
-	return nodeIdToNodeTable.size ();
+	return nodeList.size ();
 }
 
 size_t NodeManager::GetConnectionCount () const
@@ -137,8 +278,8 @@ size_t NodeManager::GetConnectionCount () const
 
 void NodeManager::EnumerateNodes (const std::function<bool (const NodePtr&)>& processor)
 {
-	for (auto& node : nodeIdToNodeTable) {
-		if (!processor (node.second)) {
+	for (const NodePtr& node : nodeList) {
+		if (!processor (node)) {
 			break;
 		}
 	}
@@ -146,8 +287,8 @@ void NodeManager::EnumerateNodes (const std::function<bool (const NodePtr&)>& pr
 
 void NodeManager::EnumerateNodes (const std::function<bool (const NodeConstPtr&)>& processor) const
 {
-	for (const auto& node : nodeIdToNodeTable) {
-		if (!processor (node.second)) {
+	for (const NodePtr& node : nodeList) {
+		if (!processor (node)) {
 			break;
 		}
 	}
@@ -155,25 +296,30 @@ void NodeManager::EnumerateNodes (const std::function<bool (const NodeConstPtr&)
 
 bool NodeManager::ContainsNode (const NodeId& id) const
 {
-	return nodeIdToNodeTable.find (id) != nodeIdToNodeTable.end ();
+	return nodeIdToIndex.find (id) != nodeIdToIndex.end ();
 }
 
 NodeConstPtr NodeManager::GetNode (const NodeId& id) const
 {
-	auto foundNode = nodeIdToNodeTable.find (id);
-	if (DBGERROR (foundNode == nodeIdToNodeTable.end ())) {
+	auto foundNode = nodeIdToIndex.find (id);
+	if (DBGERROR (foundNode == nodeIdToIndex.end ())) {
 		return nullptr;
 	}
-	return foundNode->second;
+	return nodeList[foundNode->second];
+}
+
+NodeId NodeManager::GetNextNodeId () const
+{
+	return NodeId (idGenerator.GetNextUniqueId ());
 }
 
 NodePtr NodeManager::GetNode (const NodeId& id)
 {
-	auto foundNode = nodeIdToNodeTable.find (id);
-	if (DBGERROR (foundNode == nodeIdToNodeTable.end ())) {
+	auto foundNode = nodeIdToIndex.find (id);
+	if (DBGERROR (foundNode == nodeIdToIndex.end ())) {
 		return nullptr;
 	}
-	return foundNode->second;
+	return nodeList[foundNode->second];
 }
 
 NodePtr NodeManager::AddNode (const NodePtr& node)
@@ -212,7 +358,16 @@ bool NodeManager::DeleteNode (const NodePtr& node)
 		return true;
 	});
 
-	nodeIdToNodeTable.erase (node->GetId ());
+	NodeId nodeId = node->GetId ();
+	size_t nodeIndex = nodeIdToIndex[nodeId];
+	if (nodeIndex != nodeList.size () - 1) {
+		nodeList[nodeIndex] = nodeList.back ();
+		nodeIdToIndex[nodeList[nodeIndex]->GetId ()] = nodeIndex;
+	}
+	nodeList.pop_back ();
+	nodeIdToIndex.erase (nodeId);
+	invalidatedNodes.erase (nodeId);
+	evaluationPlan.Invalidate ();
 	node->ClearNodeEvaluator ();
 
 	return true;
@@ -247,18 +402,7 @@ bool NodeManager::CanConnectOutputSlotToInputSlot (const OutputSlotConstPtr& out
 		return true;
 	}
 
-	bool willCreateCycle = false;
-	if (outputNode == inputNode) {
-		willCreateCycle = true;
-	} else {
-		EnumerateDependentNodesRecursive (inputNode, [&] (const NodeConstPtr& dependentNode) {
-			if (outputNode == dependentNode) {
-				willCreateCycle = true;
-			}
-		});
-	}
-
-	if (willCreateCycle) {
+	if (outputNode == inputNode || IsDependentNodeRecursive (inputNode, outputNode)) {
 		return false;
 	}
 
@@ -272,24 +416,33 @@ bool NodeManager::ConnectOutputSlotToInputSlot (const OutputSlotConstPtr& output
 	}
 
 	InvalidateNodeValue (GetNode (inputSlot->GetOwnerNodeId ()));
-	return connectionManager.ConnectOutputSlotToInputSlot (outputSlot, inputSlot);
+	if (!connectionManager.ConnectOutputSlotToInputSlot (outputSlot, inputSlot)) {
+		return false;
+	}
+	if (!evaluationPlan.AddDependency (outputSlot->GetOwnerNodeId (), inputSlot->GetOwnerNodeId ())) {
+		evaluationPlan.Invalidate ();
+	}
+	return true;
 }
 
 bool NodeManager::DisconnectOutputSlotFromInputSlot (const OutputSlotConstPtr& outputSlot, const InputSlotConstPtr& inputSlot)
 {
 	InvalidateNodeValue (GetNode (inputSlot->GetOwnerNodeId ()));
+	evaluationPlan.Invalidate ();
 	return connectionManager.DisconnectOutputSlotFromInputSlot (outputSlot, inputSlot);
 }
 
 bool NodeManager::DisconnectAllInputSlotsFromOutputSlot (const OutputSlotConstPtr& outputSlot)
 {
 	InvalidateNodeValue (GetNode (outputSlot->GetOwnerNodeId ()));
+	evaluationPlan.Invalidate ();
 	return connectionManager.DisconnectAllInputSlotsFromOutputSlot (outputSlot);
 }
 
 bool NodeManager::DisconnectAllOutputSlotsFromInputSlot (const InputSlotConstPtr& inputSlot)
 {
 	InvalidateNodeValue (GetNode (inputSlot->GetOwnerNodeId ()));
+	evaluationPlan.Invalidate ();
 	return connectionManager.DisconnectAllOutputSlotsFromInputSlot (inputSlot);
 }
 
@@ -325,24 +478,38 @@ void NodeManager::EnumerateConnectedInputSlots (const OutputSlotConstPtr& output
 
 void NodeManager::EvaluateAllNodes (EvaluationEnv& env) const
 {
-	EnumerateNodes ([&] (const NodeConstPtr& node) {
-		node->Evaluate (env);
-		return true;
-	});
+	if (invalidatedNodes.empty ()) {
+		return;
+	}
+
+	const NodeEvaluationPlan& plan = GetEvaluationPlan ();
+	std::vector<size_t> nodeIndices = GetInvalidatedNodeIndices (plan);
+	if (evaluationMode == EvaluationMode::Parallel) {
+		EvaluateNodesParallel (env, plan, nodeIndices);
+	} else {
+		EvaluateNodesSerial (env, plan, nodeIndices);
+	}
+
+	for (size_t nodeIndex : nodeIndices) {
+		const NodeConstPtr& node = plan.GetNode (nodeIndex);
+		if (node->HasCalculatedValue ()) {
+			invalidatedNodes.erase (node->GetId ());
+		}
+	}
 }
 
 void NodeManager::ForceEvaluateAllNodes (EvaluationEnv& env) const
 {
 	NE::ValueGuard<bool> isForceCalculateGuard (isForceCalculate, true);
 	std::vector<NodeConstPtr> nodesToRecalculate;
-	EnumerateNodes ([&] (const NodeConstPtr& node) {
+	for (const NodeId& nodeId : invalidatedNodes) {
+		NodeConstPtr node = GetNode (nodeId);
 		Node::CalculationStatus calcStatus = node->GetCalculationStatus ();
 		DBGASSERT (calcStatus != Node::CalculationStatus::NeedToCalculateButDisabled);
 		if (calcStatus == Node::CalculationStatus::NeedToCalculate) {
 			nodesToRecalculate.push_back (node);
 		}
-		return true;
-	});
+	}
 	for (const NodeConstPtr& node : nodesToRecalculate) {
 		InvalidateNodeValue (node);
 	}
@@ -357,13 +524,47 @@ void NodeManager::InvalidateNodeValue (const NodeId& nodeId) const
 
 void NodeManager::InvalidateNodeValue (const NodeConstPtr& node) const
 {
-	const NodeId& nodeId = node->GetId ();
-	if (nodeValueCache.Contains (nodeId)) {
-		nodeValueCache.Remove (nodeId);
+	if (evaluationPlan.IsValid ()) {
+		std::unordered_set<size_t> visitedNodes;
+		std::vector<size_t> nodesToInvalidate;
+		size_t nodeIndex = evaluationPlan.GetNodeIndex (node->GetId ());
+		visitedNodes.insert (nodeIndex);
+		nodesToInvalidate.push_back (nodeIndex);
+		while (!nodesToInvalidate.empty ()) {
+			size_t currentNodeIndex = nodesToInvalidate.back ();
+			nodesToInvalidate.pop_back ();
+			const NodeId& nodeId = evaluationPlan.GetNode (currentNodeIndex)->GetId ();
+			if (nodeValueCache.Contains (nodeId)) {
+				nodeValueCache.Remove (nodeId);
+			}
+			invalidatedNodes.insert (nodeId);
+			for (size_t dependentNodeIndex : evaluationPlan.GetDownstreamNodes (currentNodeIndex)) {
+				if (visitedNodes.insert (dependentNodeIndex).second) {
+					nodesToInvalidate.push_back (dependentNodeIndex);
+				}
+			}
+		}
+		return;
+	}
+
+	std::unordered_set<NodeId> visitedNodes;
+	std::vector<NodeConstPtr> nodesToInvalidate;
+	visitedNodes.insert (node->GetId ());
+	nodesToInvalidate.push_back (node);
+	while (!nodesToInvalidate.empty ()) {
+		NodeConstPtr currentNode = nodesToInvalidate.back ();
+		nodesToInvalidate.pop_back ();
+		const NodeId& nodeId = currentNode->GetId ();
+		if (nodeValueCache.Contains (nodeId)) {
+			nodeValueCache.Remove (nodeId);
+		}
+		invalidatedNodes.insert (nodeId);
+		EnumerateDependentNodes (currentNode, [&] (const NodeId& dependentNodeId) {
+			if (visitedNodes.insert (dependentNodeId).second) {
+				nodesToInvalidate.push_back (GetNode (dependentNodeId));
+			}
+		});
 	}
-	EnumerateDependentNodes (node, [&] (const NodeConstPtr& dependentNode) {
-		InvalidateNodeValue (dependentNode);
-	});
 }
 
 void NodeManager::EnumerateDependentNodes (const NodeConstPtr& node, const std::function<void (const NodeId&)>& processor) const
@@ -476,6 +677,16 @@ void NodeManager::SetUpdateMode (UpdateMode newUpdateMode)
 	updateMode = newUpdateMode;
 }
 
+NodeManager::EvaluationMode NodeManager::GetEvaluationMode () const
+{
+	return evaluationMode;
+}
+
+void NodeManager::SetEvaluationMode (EvaluationMode newEvaluationMode)
+{
+	evaluationMode = newEvaluationMode;
+}
+
 Stream::Status NodeManager::Read (InputStream& inputStream)
 {
 	if (DBGERROR (!IsEmpty ())) {
@@ -518,17 +729,69 @@ bool NodeManager::Clone (const NodeManager& source, NodeManager& target)
 		return false;
 	}
 
-	MemoryOutputStream outputStream;
-	if (DBGERROR (source.Write (outputStream) != Stream::Status::NoError)) {
-		return false;
+	std::vector<NodeConstPtr> sourceNodes (source.nodeList.begin (), source.nodeList.end ());
+	std::sort (sourceNodes.begin (), sourceNodes.end (), [&] (const NodeConstPtr& a, const NodeConstPtr& b) {
+		return a->GetId () < b->GetId ();
+	});
+
+	std::vector<NodePtr> clonedNodes;
+	clonedNodes.reserve (sourceNodes.size ());
+	for (const NodeConstPtr& sourceNode : sourceNodes) {
+		NodePtr clonedNode = Node::Clone (sourceNode);
+		if (DBGERROR (clonedNode == nullptr)) {
+			return false;
+		}
+		clonedNodes.push_back (clonedNode);
 	}
 
-	MemoryInputStream inputStream (outputStream.GetBuffer ());
-	if (DBGERROR (target.Read (inputStream) != Stream::Status::NoError)) {
+	target.idGenerator.SetNextUniqueId (source.idGenerator.GetNextUniqueId ());
+	if (DBGERROR (!target.AddInitializedNodes (clonedNodes, IdHandlingPolicy::KeepOriginalId))) {
 		return false;
 	}
 
-	return true;
+	bool success = true;
+	for (size_t nodeIndex = 0; nodeIndex < sourceNodes.size (); nodeIndex++) {
+		const NodePtr& targetNode = clonedNodes[nodeIndex];
+		sourceNodes[nodeIndex]->EnumerateInputSlots ([&] (const InputSlotConstPtr& sourceInputSlot) {
+			InputSlotConstPtr targetInputSlot = targetNode->GetInputSlot (sourceInputSlot->GetId ());
+			source.EnumerateConnectedOutputSlots (sourceInputSlot, [&] (const OutputSlotConstPtr& sourceOutputSlot) {
+				NodePtr outputNode = target.GetNode (sourceOutputSlot->GetOwnerNodeId ());
+				if (DBGERROR (outputNode == nullptr)) {
+					success = false;
+					return;
+				}
+				if (DBGERROR (!target.ConnectOutputSlotToInputSlot (outputNode->GetOutputSlot (sourceOutputSlot->GetId ()), targetInputSlot))) {
+					success = false;
+				}
+			});
+			return true;
+		});
+	}
+
+	source.EnumerateNodeGroups ([&] (const NodeGroupConstPtr& sourceGroup) {
+		NodeGroupPtr targetGroup = NodeGroup::Clone (sourceGroup);
+		if (DBGERROR (targetGroup == nullptr)) {
+			success = false;
+			return true;
+		}
+		target.AddNodeGroup (targetGroup);
+		source.GetGroupNodes (sourceGroup).Enumerate ([&] (const NodeId& nodeId) {
+			target.AddNodeToGroup (targetGroup, nodeId);
+			return true;
+		});
+		return true;
+	});
+	target.updateMode = source.updateMode;
+
+	return success;
+}
+
+size_t NodeManager::EstimateSerializedSize (size_t nodeCount, Stream::Format format)
+{
+	if (format == Stream::Format::Compact) {
+		return nodeCount * EstimatedCompactNodeSize;
+	}
+	return nodeCount * EstimatedFixedNodeSize;
 }
 
 NodePtr NodeManager::AddNode (const NodePtr& node, const NodeEvaluatorSetter& setter)
@@ -537,7 +800,10 @@ NodePtr NodeManager::AddNode (const NodePtr& node, const NodeEvaluatorSetter& se
 		return nullptr;
 	}
 	node->SetNodeEvaluator (setter);
-	nodeIdToNodeTable.insert ({ node->GetId (), node });
+	nodeIdToIndex.insert ({ node->GetId (), nodeList.size () });
+	nodeList.push_back (node);
+	evaluationPlan.Invalidate ();
+	invalidatedNodes.insert (node->GetId ());
 	return node;
 }
 
@@ -569,6 +835,117 @@ NodePtr NodeManager::AddInitializedNode (const NodePtr& node, IdHandlingPolicy i
 	return AddNode (node, setter);
 }
 
+bool NodeManager::AddInitializedNodes (const std::vector<NodePtr>& nodes, IdHandlingPolicy idHandling)
+{
+	nodeList.reserve (nodeList.size () + nodes.size ());
+	nodeIdToIndex.reserve (nodeIdToIndex.size () + nodes.size ());
+	invalidatedNodes.reserve (invalidatedNodes.size () + nodes.size ());
+
+	bool success = true;
+	for (const NodePtr& node : nodes) {
+		if (AddInitializedNode (node, idHandling) == nullptr) {
+			success = false;
+		}
+	}
+	return success;
+}
+
+bool NodeManager::IsDependentNodeRecursive (const NodeConstPtr& node, const NodeConstPtr& dependentNode) const
+{
+	if (evaluationPlan.IsValid ()) {
+		size_t nodeIndex = evaluationPlan.GetNodeIndex (node->GetId ());
+		size_t dependentNodeIndex = evaluationPlan.GetNodeIndex (dependentNode->GetId ());
+		if (nodeIndex > dependentNodeIndex) {
+			return false;
+		}
+		std::unordered_set<size_t> visitedNodes;
+		std::vector<size_t> nodesToVisit;
+		visitedNodes.insert (nodeIndex);
+		nodesToVisit.push_back (nodeIndex);
+		while (!nodesToVisit.empty ()) {
+			size_t currentNodeIndex = nodesToVisit.back ();
+			nodesToVisit.pop_back ();
+			for (size_t currentDependentNodeIndex : evaluationPlan.GetDownstreamNodes (currentNodeIndex)) {
+				if (currentDependentNodeIndex == dependentNodeIndex) {
+					return true;
+				}
+				if (currentDependentNodeIndex < dependentNodeIndex && visitedNodes.insert (currentDependentNodeIndex).second) {
+					nodesToVisit.push_back (currentDependentNodeIndex);
+				}
+			}
+		}
+		return false;
+	}
+
+	const NodeId& dependentNodeId = dependentNode->GetId ();
+	bool found = false;
+	std::unordered_set<NodeId> visitedNodes;
+	std::vector<NodeConstPtr> nodesToVisit;
+	visitedNodes.insert (node->GetId ());
+	nodesToVisit.push_back (node);
+	while (!found && !nodesToVisit.empty ()) {
+		NodeConstPtr currentNode = nodesToVisit.back ();
+		nodesToVisit.pop_back ();
+		EnumerateDependentNodes (currentNode, [&] (const NodeId& currentDependentNodeId) {
+			if (found || currentDependentNodeId == dependentNodeId) {
+				found = true;
+				return;
+			}
+			if (visitedNodes.insert (currentDependentNodeId).second) {
+				nodesToVisit.push_back (GetNode (currentDependentNodeId));
+			}
+		});
+	}
+
+	return found;
+}
+
+const OutputSlotConstPtr& NodeManager::GetConnectedOutputSlot (const InputSlotConstPtr& inputSlot) const
+{
+	return connectionManager.GetConnectedOutputSlot (inputSlot);
+}
+
+const NodeEvaluationPlan& NodeManager::GetEvaluationPlan () const
+{
+	if (!evaluationPlan.IsValid ()) {
+		evaluationPlan.Build (*this);
+	}
+	return evaluationPlan;
+}
+
+std::vector<size_t> NodeManager::GetInvalidatedNodeIndices (const NodeEvaluationPlan& plan) const
+{
+	std::vector<size_t> nodeIndices;
+	nodeIndices.reserve (invalidatedNodes.size ());
+	for (const NodeId& nodeId : invalidatedNodes) {
+		size_t nodeIndex = plan.GetNodeIndex (nodeId);
+		if (DBGVERIFY (nodeIndex < plan.GetNodeCount ())) {
+			nodeIndices.push_back (nodeIndex);
+		}
+	}
+	std::sort (nodeIndices.begin (), nodeIndices.end ());
+	return nodeIndices;
+}
+
+void NodeManager::EvaluateNodesSerial (EvaluationEnv& env, const NodeEvaluationPlan& plan, const std::vector<size_t>& nodeIndices) const
+{
+	for (size_t nodeIndex : nodeIndices) {
+		plan.GetNode (nodeIndex)->Evaluate (env);
+	}
+}
+
+void NodeManager::EvaluateNodesParallel (EvaluationEnv& env, const NodeEvaluationPlan& plan, const std::vector<size_t>& nodeIndices) const
+{
+	ThreadPool& threadPool = GetSharedThreadPool ();
+	if (threadPool.IsWorkerThread ()) {
+		EvaluateNodesSerial (env, plan, nodeIndices);
+		return;
+	}
+
+	std::shared_ptr<ParallelNodeEvaluator> parallelEvaluator (new ParallelNodeEvaluator (threadPool, env, plan, nodeIndices));
+	parallelEvaluator->Run ();
+}
+
 Stream::Status NodeManager::ReadNodes (InputStream& inputStream)
 {
 	std::unordered_map<NodeId, NodeId> oldToNewNodeIdTable;
@@ -11,7 +11,10 @@
 #include "NE_ConnectionManager.hpp"
 #include "NE_NodeGroupList.hpp"
 #include "NE_NodeValueCache.hpp"
+#include "NE_NodeEvaluationPlan.hpp"
 #include <functional>
+#include <memory>
+#include <unordered_set>
 
 namespace NE
 {
@@ -20,6 +23,8 @@ class NodeManager
 {
 	SERIALIZABLE;
 	friend class NodeManagerMerge;
+	friend class PartialNodeManagerState;
+	friend class NodeManagerNodeEvaluator;
 
 public:
 	enum class UpdateMode
@@ -28,6 +33,12 @@ public:
 		Manual
 	};
 
+	enum class EvaluationMode
+	{
+		Serial,
+		Parallel
+	};
+
 	NodeManager ();
 	NodeManager (const NodeManager& src) = delete;
 	NodeManager (NodeManager&& src) = delete;
@@ -46,6 +57,7 @@ public:
 
 	bool					ContainsNode (const NodeId& id) const;
 	NodeConstPtr			GetNode (const NodeId& id) const;
+	NodeId					GetNextNodeId () const;
 
 	NodePtr					GetNode (const NodeId& id);
 	NodePtr					AddNode (const NodePtr& node);
@@ -98,10 +110,14 @@ public:
 	UpdateMode				GetUpdateMode () const;
 	void					SetUpdateMode (UpdateMode newUpdateMode);
 
+	EvaluationMode			GetEvaluationMode () const;
+	void					SetEvaluationMode (EvaluationMode newEvaluationMode);
+
 	Stream::Status			Read (InputStream& inputStream);
 	Stream::Status			Write (OutputStream& outputStream) const;
 
 	static bool				Clone (const NodeManager& source, NodeManager& target);
+	static size_t			EstimateSerializedSize (size_t nodeCount, Stream::Format format);
 
 private:
 	enum class IdHandlingPolicy
@@ -110,20 +126,33 @@ private:
 		GenerateNewId
 	};
 
-	NodePtr				AddNode (const NodePtr& node, const NodeEvaluatorSetter& setter);
-	NodePtr				AddUninitializedNode (const NodePtr& node);
-	NodePtr				AddInitializedNode (const NodePtr& node, IdHandlingPolicy idHandling);
+	NodePtr						AddNode (const NodePtr& node, const NodeEvaluatorSetter& setter);
+	NodePtr						AddUninitializedNode (const NodePtr& node);
+	NodePtr						AddInitializedNode (const NodePtr& node, IdHandlingPolicy idHandling);
+	bool						AddInitializedNodes (const std::vector<NodePtr>& nodes, IdHandlingPolicy idHandling);
+
+	bool						IsDependentNodeRecursive (const NodeConstPtr& node, const NodeConstPtr& dependentNode) const;
+	const OutputSlotConstPtr&	GetConnectedOutputSlot (const InputSlotConstPtr& inputSlot) const;
+
+	const NodeEvaluationPlan&	GetEvaluationPlan () const;
+	std::vector<size_t>			GetInvalidatedNodeIndices (const NodeEvaluationPlan& plan) const;
+	void						EvaluateNodesSerial (EvaluationEnv& env, const NodeEvaluationPlan& plan, const std::vector<size_t>& nodeIndices) const;
+	void						EvaluateNodesParallel (EvaluationEnv& env, const NodeEvaluationPlan& plan, const std::vector<size_t>& nodeIndices) const;
 
-	Stream::Status		ReadNodes (InputStream& inputStream);
-	Stream::Status		WriteNodes (OutputStream& outputStream) const;
+	Stream::Status				ReadNodes (InputStream& inputStream);
+	Stream::Status				WriteNodes (OutputStream& outputStream) const;
 
 	NodeIdGenerator							idGenerator;
-	std::unordered_map<NodeId, NodePtr>		nodeIdToNodeTable;
+	std::vector<NodePtr>					nodeList;
+	std::unordered_map<NodeId, size_t>		nodeIdToIndex;
 	ConnectionManager						connectionManager;
 	NodeGroupList							nodeGroupList;
 	UpdateMode								updateMode;
+	EvaluationMode							evaluationMode;
 
 	mutable NodeValueCache					nodeValueCache;
+	mutable NodeEvaluationPlan				evaluationPlan;
+	mutable std::unordered_set<NodeId>		invalidatedNodes;
 	mutable NodeEvaluatorConstPtr			nodeEvaluator;
 	mutable bool							isForceCalculate;
 };
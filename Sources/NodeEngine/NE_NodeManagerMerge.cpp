@@ -1,5 +1,8 @@
 #include "NE_NodeManagerMerge.hpp"
 #include "NE_MemoryStream.hpp"
+#include "NE_ThreadPool.hpp"
+
+#include <unordered_set>
 
 namespace NE
 {
@@ -52,6 +55,42 @@ static void Sort (std::vector<NodeConstPtr>& nodes)
 	});
 }
 
+static const size_t MinParallelNodeCount = 256;
+static const size_t ParallelChunkSize = 64;
+
+static void ProcessNodes (const std::vector<NodeConstPtr>& nodes, const std::function<void (size_t)>& processor)
+{
+	if (nodes.size () < MinParallelNodeCount) {
+		for (size_t nodeIndex = 0; nodeIndex < nodes.size (); nodeIndex++) {
+			processor (nodeIndex);
+		}
+		return;
+	}
+
+	ParallelFor (GetSharedThreadPool (), nodes.size (), ParallelChunkSize, [&] (size_t begin, size_t end) {
+		for (size_t nodeIndex = begin; nodeIndex < end; nodeIndex++) {
+			if (nodes[nodeIndex]->IsThreadSafe ()) {
+				processor (nodeIndex);
+			}
+		}
+		return true;
+	});
+	for (size_t nodeIndex = 0; nodeIndex < nodes.size (); nodeIndex++) {
+		if (!nodes[nodeIndex]->IsThreadSafe ()) {
+			processor (nodeIndex);
+		}
+	}
+}
+
+static std::vector<NodePtr> CloneNodes (const std::vector<NodeConstPtr>& nodes)
+{
+	std::vector<NodePtr> clonedNodes (nodes.size ());
+	ProcessNodes (nodes, [&] (size_t nodeIndex) {
+		clonedNodes[nodeIndex] = Node::Clone (nodes[nodeIndex]);
+	});
+	return clonedNodes;
+}
+
 NodeFilter::NodeFilter ()
 {
 
@@ -75,12 +114,14 @@ bool NodeManagerMerge::AppendNodeManager (const NodeManager& source, NodeManager
 	});
 	Sort (nodesToClone);
 
-	// add nodes
+	// clone nodes, and add them in one batch
+	std::vector<NodePtr> clonedNodes = CloneNodes (nodesToClone);
+	if (DBGERROR (!target.AddInitializedNodes (clonedNodes, NodeManager::IdHandlingPolicy::GenerateNewId))) {
+		return false;
+	}
 	std::unordered_map<NodeId, NodeId> oldToNewNodeIdTable;
-	for (const NodeConstPtr& node : nodesToClone) {
-		NodePtr cloned = Node::Clone (node);
-		target.AddInitializedNode (cloned, NodeManager::IdHandlingPolicy::GenerateNewId);
-		oldToNewNodeIdTable.insert ({ node->GetId (), cloned->GetId () });
+	for (size_t nodeIndex = 0; nodeIndex < nodesToClone.size (); nodeIndex++) {
+		oldToNewNodeIdTable.insert ({ nodesToClone[nodeIndex]->GetId (), clonedNodes[nodeIndex]->GetId () });
 	}
 
 	// maintain connections between added nodes
@@ -112,22 +153,42 @@ bool NodeManagerMerge::AppendNodeManager (const NodeManager& source, NodeManager
 
 bool NodeManagerMerge::UpdateNodeManager (const NodeManager& source, NodeManager& target, MergeEventHandler& eventHandler)
 {
-	// collect nodes to create or delete
-	std::vector<NodeId> nodesToCreate;
-	std::vector<NodeId> nodesToDelete;
+	enum class NodeChange
+	{
+		None,
+		Create,
+		Replace
+	};
+
+	// compare nodes
+	const NodeManager& constTarget = target;
+	std::vector<NodeConstPtr> sourceNodes;
 	source.EnumerateNodes ([&] (const NodeConstPtr& sourceNode) {
-		if (target.ContainsNode (sourceNode->GetId ())) {
-			NodeConstPtr targetNode = target.GetNode (sourceNode->GetId ());
-			if (!Node::IsEqual (sourceNode, targetNode)) {
-				nodesToDelete.push_back (targetNode->GetId ());
-				nodesToCreate.push_back (sourceNode->GetId ());
-			}
-		} else {
-			nodesToCreate.push_back (sourceNode->GetId ());
-		}
+		sourceNodes.push_back (sourceNode);
 		return true;
 	});
-	target.EnumerateNodes ([&] (const NodeConstPtr& targetNode) {
+	std::vector<NodeChange> sourceNodeChanges (sourceNodes.size (), NodeChange::None);
+	ProcessNodes (sourceNodes, [&] (size_t nodeIndex) {
+		const NodeConstPtr& sourceNode = sourceNodes[nodeIndex];
+		if (!constTarget.ContainsNode (sourceNode->GetId ())) {
+			sourceNodeChanges[nodeIndex] = NodeChange::Create;
+		} else if (!Node::IsEqual (sourceNode, constTarget.GetNode (sourceNode->GetId ()))) {
+			sourceNodeChanges[nodeIndex] = NodeChange::Replace;
+		}
+	});
+
+	// collect nodes to create or delete
+	std::vector<NodeConstPtr> nodesToCreate;
+	std::vector<NodeId> nodesToDelete;
+	for (size_t nodeIndex = 0; nodeIndex < sourceNodes.size (); nodeIndex++) {
+		if (sourceNodeChanges[nodeIndex] == NodeChange::Replace) {
+			nodesToDelete.push_back (sourceNodes[nodeIndex]->GetId ());
+		}
+		if (sourceNodeChanges[nodeIndex] != NodeChange::None) {
+			nodesToCreate.push_back (sourceNodes[nodeIndex]);
+		}
+	}
+	constTarget.EnumerateNodes ([&] (const NodeConstPtr& targetNode) {
 		if (!source.ContainsNode (targetNode->GetId ())) {
 			nodesToDelete.push_back (targetNode->GetId ());
 		}
@@ -136,21 +197,28 @@ bool NodeManagerMerge::UpdateNodeManager (const NodeManager& source, NodeManager
 	Sort (nodesToCreate);
 	Sort (nodesToDelete);
 
-	// delete and create nodes
+	// delete nodes, then clone and add the new ones in one batch
 	for (const NodeId& nodeId : nodesToDelete) {
 		eventHandler.BeforeNodeDelete (nodeId);
 		target.DeleteNode (nodeId);
 	}
-	for (const NodeId& nodeId : nodesToCreate) {
-		NodePtr cloned = Node::Clone (source.GetNode (nodeId));
-		target.AddInitializedNode (cloned, NodeManager::IdHandlingPolicy::KeepOriginalId);
+	std::vector<NodePtr> clonedNodes = CloneNodes (nodesToCreate);
+	if (DBGERROR (!target.AddInitializedNodes (clonedNodes, NodeManager::IdHandlingPolicy::KeepOriginalId))) {
+		return false;
 	}
 
 	// collect input slots with changed connections
-	std::unordered_map<InputSlotConstPtr, std::vector<SlotInfo>> inputSlotsToReconnect;
-	target.EnumerateNodes ([&] (const NodeConstPtr& targetNode) {
+	using InputSlotConnections = std::pair<InputSlotConstPtr, std::vector<SlotInfo>>;
+	std::vector<NodeConstPtr> targetNodes;
+	constTarget.EnumerateNodes ([&] (const NodeConstPtr& targetNode) {
+		targetNodes.push_back (targetNode);
+		return true;
+	});
+	std::vector<std::vector<InputSlotConnections>> inputSlotsToReconnect (targetNodes.size ());
+	ProcessNodes (targetNodes, [&] (size_t nodeIndex) {
+		const NodeConstPtr& targetNode = targetNodes[nodeIndex];
 		if (!source.ContainsNode (targetNode->GetId ())) {
-			return true;
+			return;
 		}
 		NodeConstPtr sourceNode = source.GetNode (targetNode->GetId ());
 		targetNode->EnumerateInputSlots ([&] (const InputSlotConstPtr& targetInputSlot) {
@@ -159,24 +227,25 @@ bool NodeManagerMerge::UpdateNodeManager (const NodeManager& source, NodeManager
 			}
 			InputSlotConstPtr sourceInputSlot = sourceNode->GetInputSlot (targetInputSlot->GetId ());
 			std::vector<SlotInfo> sourceOutputSlots = GetConnectedOutputSlots (source, sourceInputSlot);
-			std::vector<SlotInfo> targetOutputSlots = GetConnectedOutputSlots (target, targetInputSlot);
+			std::vector<SlotInfo> targetOutputSlots = GetConnectedOutputSlots (constTarget, targetInputSlot);
 			if (sourceOutputSlots != targetOutputSlots) {
-				inputSlotsToReconnect.insert ({ targetInputSlot, sourceOutputSlots });
+				inputSlotsToReconnect[nodeIndex].push_back ({ targetInputSlot, sourceOutputSlots });
 			}
 			return true;
 		});
-		return true;
 	});
 
 	// reconnect changed input slots
-	for (const auto& inputSlotData : inputSlotsToReconnect) {
-		const InputSlotConstPtr& inputSlot = inputSlotData.first;
-		const std::vector<SlotInfo>& outputSlots = inputSlotData.second;
-		target.DisconnectAllOutputSlotsFromInputSlot (inputSlot);
-		for (const SlotInfo& slotInfo : outputSlots) {
-			NodeConstPtr outputNode = target.GetNode (slotInfo.GetNodeId ());
-			OutputSlotConstPtr outputSlot = outputNode->GetOutputSlot (slotInfo.GetSlotId ());
-			target.ConnectOutputSlotToInputSlot (outputSlot, inputSlot);
+	for (const std::vector<InputSlotConnections>& nodeInputSlots : inputSlotsToReconnect) {
+		for (const InputSlotConnections& inputSlotData : nodeInputSlots) {
+			const InputSlotConstPtr& inputSlot = inputSlotData.first;
+			const std::vector<SlotInfo>& outputSlots = inputSlotData.second;
+			target.DisconnectAllOutputSlotsFromInputSlot (inputSlot);
+			for (const SlotInfo& slotInfo : outputSlots) {
+				NodeConstPtr outputNode = constTarget.GetNode (slotInfo.GetNodeId ());
+				OutputSlotConstPtr outputSlot = outputNode->GetOutputSlot (slotInfo.GetSlotId ());
+				target.ConnectOutputSlotToInputSlot (outputSlot, inputSlot);
+			}
 		}
 	}
 
@@ -198,4 +267,254 @@ bool NodeManagerMerge::UpdateNodeManager (const NodeManager& source, NodeManager
 	return true;
 }
 
+PartialNodeManagerState::PartialNodeManagerState () :
+	stateData (),
+	hasGroups (false)
+{
+
+}
+
+PartialNodeManagerState::~PartialNodeManagerState ()
+{
+
+}
+
+bool PartialNodeManagerState::Save (const NodeManager& nodeManager, const NodeCollection& nodes, bool saveGroups, CompressionMode compression)
+{
+	hasGroups = saveGroups;
+	nodes.Enumerate ([&] (const NodeId& nodeId) {
+		if (nodeManager.ContainsNode (nodeId) && nodeManager.GetNodeGroup (nodeId) != nullptr) {
+			hasGroups = true;
+		}
+		return true;
+	});
+
+	MemoryOutputStream outputStream;
+	outputStream.SetFormat (Stream::Format::Compact);
+	outputStream.Reserve (NodeManager::EstimateSerializedSize (nodes.Count (), Stream::Format::Compact));
+	if (DBGERROR (WriteState (outputStream, nodeManager, nodes) != Stream::Status::NoError)) {
+		return false;
+	}
+
+	stateData.Set (outputStream.GetBuffer (), compression);
+	return true;
+}
+
+bool PartialNodeManagerState::Restore (NodeManager& nodeManager, const NodeCollection& nodes, MergeEventHandler& eventHandler) const
+{
+	std::vector<char> data;
+	if (DBGERROR (!stateData.Get (data))) {
+		return false;
+	}
+
+	MemoryInputStream inputStream (data);
+	inputStream.SetFormat (Stream::Format::Compact);
+	if (DBGERROR (ReadState (inputStream, nodeManager, nodes, eventHandler) != Stream::Status::NoError)) {
+		return false;
+	}
+
+	return true;
+}
+
+bool PartialNodeManagerState::HasGroups () const
+{
+	return hasGroups;
+}
+
+size_t PartialNodeManagerState::GetSize () const
+{
+	return stateData.GetSize ();
+}
+
+Stream::Status PartialNodeManagerState::WriteState (OutputStream& outputStream, const NodeManager& nodeManager, const NodeCollection& nodes) const
+{
+	std::vector<NodeConstPtr> savedNodes;
+	std::vector<InputSlotConstPtr> inputSlots;
+	std::unordered_set<InputSlotConstPtr> inputSlotSet;
+	auto AddInputSlot = [&] (const InputSlotConstPtr& inputSlot) {
+		if (inputSlotSet.insert (inputSlot).second) {
+			inputSlots.push_back (inputSlot);
+		}
+	};
+
+	nodes.Enumerate ([&] (const NodeId& nodeId) {
+		if (!nodeManager.ContainsNode (nodeId)) {
+			return true;
+		}
+		NodeConstPtr node = nodeManager.GetNode (nodeId);
+		savedNodes.push_back (node);
+		node->EnumerateInputSlots ([&] (const InputSlotConstPtr& inputSlot) {
+			AddInputSlot (inputSlot);
+			return true;
+		});
+		node->EnumerateOutputSlots ([&] (const OutputSlotConstPtr& outputSlot) {
+			nodeManager.EnumerateConnectedInputSlots (outputSlot, AddInputSlot);
+			return true;
+		});
+		return true;
+	});
+
+	outputStream.Write (savedNodes.size ());
+	for (const NodeConstPtr& node : savedNodes) {
+		if (DBGERROR (!WriteDynamicObject (outputStream, node.get ()))) {
+			return Stream::Status::Error;
+		}
+	}
+
+	outputStream.Write (inputSlots.size ());
+	for (const InputSlotConstPtr& inputSlot : inputSlots) {
+		inputSlot->GetOwnerNodeId ().Write (outputStream);
+		inputSlot->GetId ().Write (outputStream);
+		std::vector<SlotInfo> outputSlots = GetConnectedOutputSlots (nodeManager, inputSlot);
+		outputStream.Write (outputSlots.size ());
+		for (const SlotInfo& outputSlotInfo : outputSlots) {
+			outputSlotInfo.GetNodeId ().Write (outputStream);
+			outputSlotInfo.GetSlotId ().Write (outputStream);
+		}
+	}
+
+	if (hasGroups) {
+		std::vector<NodeGroupConstPtr> groups;
+		nodeManager.EnumerateNodeGroups ([&] (const NodeGroupConstPtr& group) {
+			groups.push_back (group);
+			return true;
+		});
+		outputStream.Write (groups.size ());
+		for (const NodeGroupConstPtr& group : groups) {
+			if (DBGERROR (!WriteDynamicObject (outputStream, group.get ()))) {
+				return Stream::Status::Error;
+			}
+			nodeManager.GetGroupNodes (group).Write (outputStream);
+		}
+	}
+
+	return outputStream.GetStatus ();
+}
+
+Stream::Status PartialNodeManagerState::ReadState (InputStream& inputStream, NodeManager& nodeManager, const NodeCollection& nodes, MergeEventHandler& eventHandler) const
+{
+	// read the whole state before touching the node manager
+	std::vector<NodePtr> savedNodes;
+	size_t nodeCount = 0;
+	inputStream.Read (nodeCount);
+	for (size_t i = 0; i < nodeCount && inputStream.GetStatus () == Stream::Status::NoError; i++) {
+		NodePtr node (ReadDynamicObject<Node> (inputStream));
+		if (DBGERROR (node == nullptr)) {
+			return Stream::Status::Error;
+		}
+		savedNodes.push_back (node);
+	}
+
+	using SavedInputSlot = std::pair<SlotInfo, std::vector<SlotInfo>>;
+	std::vector<SavedInputSlot> savedInputSlots;
+	size_t inputSlotCount = 0;
+	inputStream.Read (inputSlotCount);
+	for (size_t i = 0; i < inputSlotCount && inputStream.GetStatus () == Stream::Status::NoError; i++) {
+		NodeId inputNodeId;
+		SlotId inputSlotId;
+		inputNodeId.Read (inputStream);
+		inputSlotId.Read (inputStream);
+
+		std::vector<SlotInfo> outputSlots;
+		size_t outputSlotCount = 0;
+		inputStream.Read (outputSlotCount);
+		for (size_t j = 0; j < outputSlotCount && inputStream.GetStatus () == Stream::Status::NoError; j++) {
+			NodeId outputNodeId;
+			SlotId outputSlotId;
+			outputNodeId.Read (inputStream);
+			outputSlotId.Read (inputStream);
+			outputSlots.push_back (SlotInfo (outputNodeId, outputSlotId));
+		}
+		savedInputSlots.push_back ({ SlotInfo (inputNodeId, inputSlotId), outputSlots });
+	}
+
+	using SavedGroup = std::pair<NodeGroupPtr, NodeCollection>;
+	std::vector<SavedGroup> savedGroups;
+	if (hasGroups) {
+		size_t groupCount = 0;
+		inputStream.Read (groupCount);
+		for (size_t i = 0; i < groupCount && inputStream.GetStatus () == Stream::Status::NoError; i++) {
+			NodeGroupPtr group (ReadDynamicObject<NodeGroup> (inputStream));
+			if (DBGERROR (group == nullptr)) {
+				return Stream::Status::Error;
+			}
+			NodeCollection groupNodes;
+			groupNodes.Read (inputStream);
+			savedGroups.push_back ({ group, groupNodes });
+		}
+	}
+
+	if (inputStream.GetStatus () != Stream::Status::NoError) {
+		return inputStream.GetStatus ();
+	}
+
+	// delete the current version of the nodes
+	nodes.Enumerate ([&] (const NodeId& nodeId) {
+		if (nodeManager.ContainsNode (nodeId)) {
+			eventHandler.BeforeNodeDelete (nodeId);
+			nodeManager.DeleteNode (nodeId);
+		}
+		return true;
+	});
+
+	// add the saved nodes
+	bool success = true;
+	for (const NodePtr& node : savedNodes) {
+		if (DBGERROR (nodeManager.AddInitializedNode (node, NodeManager::IdHandlingPolicy::KeepOriginalId) == nullptr)) {
+			success = false;
+		}
+	}
+
+	// reconnect input slots in the saved order
+	for (const SavedInputSlot& inputSlotData : savedInputSlots) {
+		const SlotInfo& inputSlotInfo = inputSlotData.first;
+		if (DBGERROR (!nodeManager.ContainsNode (inputSlotInfo.GetNodeId ()))) {
+			success = false;
+			continue;
+		}
+		NodeConstPtr inputNode = nodeManager.GetNode (inputSlotInfo.GetNodeId ());
+		if (DBGERROR (!inputNode->HasInputSlot (inputSlotInfo.GetSlotId ()))) {
+			success = false;
+			continue;
+		}
+		InputSlotConstPtr inputSlot = inputNode->GetInputSlot (inputSlotInfo.GetSlotId ());
+		nodeManager.DisconnectAllOutputSlotsFromInputSlot (inputSlot);
+		for (const SlotInfo& outputSlotInfo : inputSlotData.second) {
+			if (DBGERROR (!nodeManager.ContainsNode (outputSlotInfo.GetNodeId ()))) {
+				success = false;
+				continue;
+			}
+			NodeConstPtr outputNode = nodeManager.GetNode (outputSlotInfo.GetNodeId ());
+			if (DBGERROR (!outputNode->HasOutputSlot (outputSlotInfo.GetSlotId ()))) {
+				success = false;
+				continue;
+			}
+			OutputSlotConstPtr outputSlot = outputNode->GetOutputSlot (outputSlotInfo.GetSlotId ());
+			if (DBGERROR (!nodeManager.ConnectOutputSlotToInputSlot (outputSlot, inputSlot))) {
+				success = false;
+			}
+		}
+	}
+
+	// recreate groups
+	if (hasGroups) {
+		nodeManager.DeleteAllNodeGroups ();
+		for (const SavedGroup& groupData : savedGroups) {
+			const NodeGroupPtr& group = groupData.first;
+			nodeManager.AddNodeGroup (group);
+			groupData.second.Enumerate ([&] (const NodeId& nodeId) {
+				if (nodeManager.ContainsNode (nodeId)) {
+					nodeManager.AddNodeToGroup (group, nodeId);
+				}
+				return true;
+			});
+		}
+	}
+
+	if (!success) {
+		return Stream::Status::Error;
+	}
+	return Stream::Status::NoError;
+}
+
 }
@@ -2,6 +2,9 @@
 #define NE_NODEMANAGERMERGRE_HPP
 
 #include "NE_NodeManager.hpp"
+#include "NE_Compression.hpp"
+
+#include <vector>
 
 namespace NE
 {
@@ -31,6 +34,28 @@ public:
 	static bool UpdateNodeManager (const NodeManager& source, NodeManager& target, MergeEventHandler& eventHandler);
 };
 
+// Saves the given nodes with the connections of every input slot they
+// are connected to, so they can be restored without touching other nodes.
+// The state is kept in serialized form, and it is read back only on restore.
+
+class PartialNodeManagerState
+{
+public:
+	PartialNodeManagerState ();
+	~PartialNodeManagerState ();
+
+	bool	Save (const NodeManager& nodeManager, const NodeCollection& nodes, bool saveGroups, CompressionMode compression);
+	bool	Restore (NodeManager& nodeManager, const NodeCollection& nodes, MergeEventHandler& eventHandler) const;
+	bool	HasGroups () const;
+	size_t	GetSize () const;
+
+private:
+	Stream::Status	WriteState (OutputStream& outputStream, const NodeManager& nodeManager, const NodeCollection& nodes) const;
+	Stream::Status	ReadState (InputStream& inputStream, NodeManager& nodeManager, const NodeCollection& nodes, MergeEventHandler& eventHandler) const;
+
+	CompressedBuffer	stateData;
+	bool				hasGroups;
+};
 
 }
 
@@ -16,7 +16,8 @@ NodeValueCache::~NodeValueCache ()
 
 bool NodeValueCache::Add (const NodeId& id, const ValueConstPtr& value)
 {
-	if (DBGERROR (Contains (id))) {
+	std::lock_guard<std::mutex> lock (cacheMutex);
+	if (DBGERROR (cache.find (id) != cache.end ())) {
 		return false;
 	}
 	cache.insert ({ id, value });
@@ -25,7 +26,8 @@ bool NodeValueCache::Add (const NodeId& id, const ValueConstPtr& value)
 
 bool NodeValueCache::Remove (const NodeId& id)
 {
-	if (DBGERROR (!Contains (id))) {
+	std::lock_guard<std::mutex> lock (cacheMutex);
+	if (DBGERROR (cache.find (id) == cache.end ())) {
 		return false;
 	}
 	cache.erase (id);
@@ -34,16 +36,19 @@ bool NodeValueCache::Remove (const NodeId& id)
 
 void NodeValueCache::Clear ()
 {
+	std::lock_guard<std::mutex> lock (cacheMutex);
 	return cache.clear ();
 }
 
 bool NodeValueCache::Contains (const NodeId& id) const
 {
+	std::lock_guard<std::mutex> lock (cacheMutex);
 	return cache.find (id) != cache.end ();
 }
 
 const ValueConstPtr& NodeValueCache::Get (const NodeId& id) const
 {
+	std::lock_guard<std::mutex> lock (cacheMutex);
 	return cache.at (id);
 }
 
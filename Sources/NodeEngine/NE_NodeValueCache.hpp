@@ -4,6 +4,7 @@
 #include "NE_NodeId.hpp"
 #include "NE_Value.hpp"
 #include <unordered_map>
+#include <mutex>
 
 namespace NE
 {
@@ -23,6 +24,7 @@ public:
 
 private:
 	std::unordered_map<NodeId, ValueConstPtr>	cache;
+	mutable std::mutex							cacheMutex;
 };
 
 }
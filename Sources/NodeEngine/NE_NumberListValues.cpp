@@ -0,0 +1,97 @@
+#include "NE_NumberListValues.hpp"
+
+namespace NE
+{
+
+DynamicSerializationInfo	IntListValue::serializationInfo (ObjectId ("{0F4E6A8B-5C3D-4B2A-9E1F-7A6B5C4D3E2F}"), ObjectVersion (1), IntListValue::CreateSerializableInstance);
+DynamicSerializationInfo	DoubleListValue::serializationInfo (ObjectId ("{3B9D2C71-8E4F-4A6D-B5C2-1F0E9D8C7B6A}"), ObjectVersion (1), DoubleListValue::CreateSerializableInstance);
+
+IntListValue::IntListValue () :
+	GenericListValue<int, IntValue> ()
+{
+	AddKind (IntListValueKind);
+}
+
+IntListValue::IntListValue (const std::vector<int>& items) :
+	GenericListValue<int, IntValue> (items)
+{
+	AddKind (IntListValueKind);
+}
+
+IntListValue::IntListValue (std::vector<int>&& items) :
+	GenericListValue<int, IntValue> (std::move (items))
+{
+	AddKind (IntListValueKind);
+}
+
+IntListValue::~IntListValue ()
+{
+
+}
+
+ValuePtr IntListValue::Clone () const
+{
+	return ValuePtr (new IntListValue (items));
+}
+
+Stream::Status IntListValue::Read (InputStream& inputStream)
+{
+	ObjectHeader header (inputStream);
+	Value::Read (inputStream);
+	ReadItems (inputStream);
+	return inputStream.GetStatus ();
+}
+
+Stream::Status IntListValue::Write (OutputStream& outputStream) const
+{
+	ObjectHeader header (outputStream, serializationInfo);
+	Value::Write (outputStream);
+	WriteItems (outputStream);
+	return outputStream.GetStatus ();
+}
+
+DoubleListValue::DoubleListValue () :
+	GenericListValue<double, DoubleValue> ()
+{
+	AddKind (DoubleListValueKind);
+}
+
+DoubleListValue::DoubleListValue (const std::vector<double>& items) :
+	GenericListValue<double, DoubleValue> (items)
+{
+	AddKind (DoubleListValueKind);
+}
+
+DoubleListValue::DoubleListValue (std::vector<double>&& items) :
+	GenericListValue<double, DoubleValue> (std::move (items))
+{
+	AddKind (DoubleListValueKind);
+}
+
+DoubleListValue::~DoubleListValue ()
+{
+
+}
+
+ValuePtr DoubleListValue::Clone () const
+{
+	return ValuePtr (new DoubleListValue (items));
+}
+
+Stream::Status DoubleListValue::Read (InputStream& inputStream)
+{
+	ObjectHeader header (inputStream);
+	Value::Read (inputStream);
+	ReadItems (inputStream);
+	return inputStream.GetStatus ();
+}
+
+Stream::Status DoubleListValue::Write (OutputStream& outputStream) const
+{
+	ObjectHeader header (outputStream, serializationInfo);
+	Value::Write (outputStream);
+	WriteItems (outputStream);
+	return outputStream.GetStatus ();
+}
+
+}
@@ -0,0 +1,270 @@
+#ifndef NE_NUMBERLISTVALUES_HPP
+#define NE_NUMBERLISTVALUES_HPP
+
+#include "NE_Value.hpp"
+#include "NE_SingleValues.hpp"
+#include "NE_Debug.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace NE
+{
+
+template <class Type, class ValueType>
+class GenericListValue : public ListValue
+{
+public:
+	GenericListValue ();
+	GenericListValue (const std::vector<Type>& items);
+	GenericListValue (std::vector<Type>&& items);
+	virtual ~GenericListValue ();
+
+	virtual std::wstring			ToString (const StringSettings& stringSettings) const override;
+
+	virtual size_t					GetSize () const override;
+	virtual const ValueConstPtr&	GetValue (size_t index) const override;
+	virtual void					Enumerate (const std::function<void (const ValueConstPtr&)>& processor) const override;
+	virtual void					Push (const ValueConstPtr& value) override;
+	virtual ValueKind				GetItemKind () const override;
+	virtual size_t					GetDepth () const override;
+	virtual size_t					GetFlatSize () const override;
+
+	void							Reserve (size_t count);
+	void							PushItem (const Type& item);
+	const Type&						GetItem (size_t index) const;
+	const std::vector<Type>&		GetItems () const;
+
+protected:
+	Stream::Status					ReadItems (InputStream& inputStream);
+	Stream::Status					WriteItems (OutputStream& outputStream) const;
+
+	std::vector<Type>					items;
+
+private:
+	void								CreateBoxedValues () const;
+
+	mutable std::vector<ValueConstPtr>	boxedValues;
+	mutable std::atomic<bool>			hasBoxedValues;
+	mutable std::mutex					boxedValuesMutex;
+};
+
+template <class Type, class ValueType>
+GenericListValue<Type, ValueType>::GenericListValue () :
+	GenericListValue (std::vector<Type> ())
+{
+
+}
+
+template <class Type, class ValueType>
+GenericListValue<Type, ValueType>::GenericListValue (const std::vector<Type>& items) :
+	GenericListValue (std::vector<Type> (items))
+{
+
+}
+
+template <class Type, class ValueType>
+GenericListValue<Type, ValueType>::GenericListValue (std::vector<Type>&& items) :
+	ListValue (),
+	items (std::move (items)),
+	boxedValues (),
+	hasBoxedValues (false),
+	boxedValuesMutex ()
+{
+
+}
+
+template <class Type, class ValueType>
+GenericListValue<Type, ValueType>::~GenericListValue ()
+{
+
+}
+
+template <class Type, class ValueType>
+std::wstring GenericListValue<Type, ValueType>::ToString (const StringSettings& stringSettings) const
+{
+	std::wstring result;
+	for (size_t i = 0; i < items.size (); ++i) {
+		result += ValueType (items[i]).ToString (stringSettings);
+		if (i < items.size () - 1) {
+			result += stringSettings.GetListSeparator ();
+			result += ' ';
+		}
+	}
+	return result;
+}
+
+template <class Type, class ValueType>
+size_t GenericListValue<Type, ValueType>::GetSize () const
+{
+	return items.size ();
+}
+
+template <class Type, class ValueType>
+const ValueConstPtr& GenericListValue<Type, ValueType>::GetValue (size_t index) const
+{
+	if (!hasBoxedValues.load (std::memory_order_acquire)) {
+		CreateBoxedValues ();
+	}
+	return boxedValues[index];
+}
+
+template <class Type, class ValueType>
+void GenericListValue<Type, ValueType>::Enumerate (const std::function<void (const ValueConstPtr&)>& processor) const
+{
+	if (hasBoxedValues.load (std::memory_order_acquire)) {
+		for (const ValueConstPtr& value : boxedValues) {
+			processor (value);
+		}
+		return;
+	}
+	for (const Type& item : items) {
+		processor (ValueType::Create (item));
+	}
+}
+
+template <class Type, class ValueType>
+void GenericListValue<Type, ValueType>::Push (const ValueConstPtr& value)
+{
+	if (DBGERROR (!Value::IsType<ValueType> (value))) {
+		return;
+	}
+	PushItem (ValueType::Get (value));
+}
+
+template <class Type, class ValueType>
+ValueKind GenericListValue<Type, ValueType>::GetItemKind () const
+{
+	static const ValueKind itemKind = ValueType ().GetKind ();
+	return itemKind;
+}
+
+template <class Type, class ValueType>
+size_t GenericListValue<Type, ValueType>::GetDepth () const
+{
+	return 1;
+}
+
+template <class Type, class ValueType>
+size_t GenericListValue<Type, ValueType>::GetFlatSize () const
+{
+	return items.size ();
+}
+
+template <class Type, class ValueType>
+void GenericListValue<Type, ValueType>::Reserve (size_t count)
+{
+	items.reserve (count);
+}
+
+template <class Type, class ValueType>
+void GenericListValue<Type, ValueType>::PushItem (const Type& item)
+{
+	items.push_back (item);
+	if (hasBoxedValues.load (std::memory_order_acquire)) {
+		boxedValues.push_back (ValueType::Create (item));
+	}
+}
+
+template <class Type, class ValueType>
+const Type& GenericListValue<Type, ValueType>::GetItem (size_t index) const
+{
+	return items[index];
+}
+
+template <class Type, class ValueType>
+const std::vector<Type>& GenericListValue<Type, ValueType>::GetItems () const
+{
+	return items;
+}
+
+template <class Type, class ValueType>
+Stream::Status GenericListValue<Type, ValueType>::ReadItems (InputStream& inputStream)
+{
+	static const size_t MaxItemReadCount = 65536;
+
+	size_t itemCount = 0;
+	inputStream.Read (itemCount);
+	if (inputStream.GetStatus () != Stream::Status::NoError) {
+		return inputStream.GetStatus ();
+	}
+	items.clear ();
+	while (items.size () < itemCount) {
+		size_t readCount = std::min (itemCount - items.size (), MaxItemReadCount);
+		size_t readStart = items.size ();
+		items.resize (readStart + readCount);
+		if (inputStream.ReadArray (&items[readStart], readCount) != Stream::Status::NoError) {
+			items.resize (readStart);
+			break;
+		}
+	}
+	boxedValues.clear ();
+	hasBoxedValues.store (false, std::memory_order_release);
+	return inputStream.GetStatus ();
+}
+
+template <class Type, class ValueType>
+Stream::Status GenericListValue<Type, ValueType>::WriteItems (OutputStream& outputStream) const
+{
+	outputStream.Write (items.size ());
+	outputStream.WriteArray (items.data (), items.size ());
+	return outputStream.GetStatus ();
+}
+
+template <class Type, class ValueType>
+void GenericListValue<Type, ValueType>::CreateBoxedValues () const
+{
+	std::lock_guard<std::mutex> lock (boxedValuesMutex);
+	if (hasBoxedValues.load (std::memory_order_relaxed)) {
+		return;
+	}
+	boxedValues.reserve (items.size ());
+	for (const Type& item : items) {
+		boxedValues.push_back (ValueType::Create (item));
+	}
+	hasBoxedValues.store (true, std::memory_order_release);
+}
+
+class IntListValue : public GenericListValue<int, IntValue>
+{
+	DYNAMIC_SERIALIZABLE (IntListValue);
+
+public:
+	IntListValue ();
+	IntListValue (const std::vector<int>& items);
+	IntListValue (std::vector<int>&& items);
+	virtual ~IntListValue ();
+
+	virtual ValuePtr		Clone () const override;
+
+	virtual Stream::Status	Read (InputStream& inputStream) override;
+	virtual Stream::Status	Write (OutputStream& outputStream) const override;
+};
+
+class DoubleListValue : public GenericListValue<double, DoubleValue>
+{
+	DYNAMIC_SERIALIZABLE (DoubleListValue);
+
+public:
+	DoubleListValue ();
+	DoubleListValue (const std::vector<double>& items);
+	DoubleListValue (std::vector<double>&& items);
+	virtual ~DoubleListValue ();
+
+	virtual ValuePtr		Clone () const override;
+
+	virtual Stream::Status	Read (InputStream& inputStream) override;
+	virtual Stream::Status	Write (OutputStream& outputStream) const override;
+};
+
+using IntListValuePtr = std::shared_ptr<IntListValue>;
+using IntListValueConstPtr = std::shared_ptr<const IntListValue>;
+
+using DoubleListValuePtr = std::shared_ptr<DoubleListValue>;
+using DoubleListValueConstPtr = std::shared_ptr<const DoubleListValue>;
+
+}
+
+#endif
@@ -30,6 +30,16 @@ ValueConstPtr OutputSlot::Evaluate (EvaluationEnv& env) const
 	return EvaluateOwnerNode (env);
 }
 
+OutputSlotPtr OutputSlot::CreateClone () const
+{
+	return OutputSlotPtr (new OutputSlot (*this));
+}
+
+OutputSlotPtr OutputSlot::Clone (const OutputSlotConstPtr& outputSlot)
+{
+	return CloneDynamicObject (outputSlot);
+}
+
 Stream::Status OutputSlot::Read (InputStream& inputStream)
 {
 	ObjectHeader header (inputStream);
@@ -18,6 +18,9 @@ public:
 
 	virtual ValueConstPtr	Evaluate (EvaluationEnv& env) const;
 
+	virtual OutputSlotPtr	CreateClone () const;
+	static OutputSlotPtr	Clone (const OutputSlotConstPtr& outputSlot);
+
 	virtual Stream::Status	Read (InputStream& inputStream) override;
 	virtual Stream::Status	Write (OutputStream& outputStream) const override;
 
@@ -1,4 +1,5 @@
 #include "NE_Serializable.hpp"
+#include "NE_MemoryStream.hpp"
 #include <unordered_map>
 
 namespace NE
@@ -24,12 +25,13 @@ public:
 		objectMap.insert ({ objectId, serializationInfo });
 	}
 
-	const DynamicSerializationInfo* GetSerializationInfo (const ObjectId& objectId)
+	const DynamicSerializationInfo* GetSerializationInfo (const ObjectId& objectId) const
 	{
-		if (DBGERROR (objectMap.find (objectId) == objectMap.end ())) {
+		auto foundObject = objectMap.find (objectId);
+		if (DBGERROR (foundObject == objectMap.end ())) {
 			return nullptr;
 		}
-		return objectMap[objectId];
+		return foundObject->second;
 	}
 
 private:
@@ -44,13 +46,15 @@ static ObjectRegistry& GetObjectRegistry ()
 
 
 ObjectId::ObjectId () :
-	id ("")
+	id (""),
+	hashValue (std::hash<std::string> {} (id))
 {
 
 }
 
 ObjectId::ObjectId (const std::string& id) :
-	id (id)
+	id (id),
+	hashValue (std::hash<std::string> {} (id))
 {
 
 }
@@ -62,24 +66,25 @@ ObjectId::~ObjectId ()
 
 size_t ObjectId::GenerateHashValue () const
 {
-	return std::hash<std::string> {} (id);
+	return hashValue;
 }
 
 Stream::Status ObjectId::Read (InputStream& inputStream)
 {
-	inputStream.Read (id);
+	inputStream.ReadIdentifier (id);
+	hashValue = std::hash<std::string> {} (id);
 	return inputStream.GetStatus ();
 }
 
 Stream::Status ObjectId::Write (OutputStream& outputStream) const
 {
-	outputStream.Write (id);
+	outputStream.WriteIdentifier (id);
 	return outputStream.GetStatus ();
 }
 
 bool ObjectId::operator== (const ObjectId& rhs) const
 {
-	return id == rhs.id;
+	return hashValue == rhs.hashValue && id == rhs.id;
 }
 
 bool ObjectId::operator!= (const ObjectId& rhs) const
@@ -208,14 +213,38 @@ DynamicSerializable* CreateDynamicObject (const ObjectId& objectId)
 	return dynamicSerializationInfo->CreateInstance ();
 }
 
+static const DynamicSerializationInfo* ReadSerializationInfo (InputStream& inputStream)
+{
+	if (inputStream.GetFormat () == Stream::Format::Fixed) {
+		ObjectId objectId;
+		if (objectId.Read (inputStream) != Stream::Status::NoError) {
+			return nullptr;
+		}
+		return GetObjectRegistry ().GetSerializationInfo (objectId);
+	}
+
+	size_t identifierIndex = 0;
+	if (inputStream.ReadIdentifierIndex (identifierIndex) != Stream::Status::NoError) {
+		return nullptr;
+	}
+	const DynamicSerializationInfo* serializationInfo = static_cast<const DynamicSerializationInfo*> (inputStream.GetIdentifierData (identifierIndex));
+	if (serializationInfo == nullptr) {
+		serializationInfo = GetObjectRegistry ().GetSerializationInfo (ObjectId (inputStream.GetIdentifier (identifierIndex)));
+		inputStream.SetIdentifierData (identifierIndex, serializationInfo);
+	}
+	return serializationInfo;
+}
+
 DynamicSerializable* ReadDynamicObject (InputStream& inputStream)
 {
-	ObjectId objectId;
-	objectId.Read (inputStream);
+	const DynamicSerializationInfo* serializationInfo = ReadSerializationInfo (inputStream);
 	if (inputStream.GetStatus () != Stream::Status::NoError) {
 		return nullptr;
 	}
-	DynamicSerializable* serializable = CreateDynamicObject (objectId);
+	if (DBGERROR (serializationInfo == nullptr)) {
+		return nullptr;
+	}
+	DynamicSerializable* serializable = serializationInfo->CreateInstance ();
 	if (DBGERROR (serializable == nullptr)) {
 		return nullptr;
 	}
@@ -240,4 +269,17 @@ bool WriteDynamicObject (OutputStream& outputStream, const DynamicSerializable*
 	return true;
 }
 
+DynamicSerializable* CloneDynamicObject (const DynamicSerializable* object)
+{
+	MemoryOutputStream outputStream;
+	outputStream.SetFormat (Stream::Format::Compact);
+	if (DBGERROR (!WriteDynamicObject (outputStream, object))) {
+		return nullptr;
+	}
+
+	MemoryInputStream inputStream (outputStream.GetBuffer ());
+	inputStream.SetFormat (Stream::Format::Compact);
+	return ReadDynamicObject (inputStream);
+}
+
 }
@@ -4,6 +4,9 @@
 #include "NE_Stream.hpp"
 #include "NE_Debug.hpp"
 
+#include <memory>
+#include <typeinfo>
+
 namespace NE
 {
 
@@ -23,7 +26,8 @@ public:
 	bool				operator!= (const ObjectId& rhs) const;
 
 private:
-	std::string id;
+	std::string	id;
+	size_t		hashValue;
 };
 
 class ObjectVersion
@@ -100,6 +104,7 @@ public:
 DynamicSerializable*	CreateDynamicObject (const ObjectId& objectId);
 DynamicSerializable*	ReadDynamicObject (InputStream& inputStream);
 bool					WriteDynamicObject (OutputStream& outputStream, const DynamicSerializable* object);
+DynamicSerializable*	CloneDynamicObject (const DynamicSerializable* object);
 
 template <class ObjectType>
 ObjectType* ReadDynamicObject (InputStream& inputStream)
@@ -113,6 +118,31 @@ ObjectType* ReadDynamicObject (InputStream& inputStream)
 	return typedObj;
 }
 
+template <class ObjectType>
+ObjectType* CloneDynamicObject (const ObjectType* object)
+{
+	DynamicSerializable* obj = CloneDynamicObject (static_cast<const DynamicSerializable*> (object));
+	ObjectType* typedObj = dynamic_cast<ObjectType*> (obj);
+	if (DBGERROR (typedObj == nullptr)) {
+		delete obj;
+		return nullptr;
+	}
+	return typedObj;
+}
+
+// Copies the object with its CreateClone function. If the most derived class
+// does not implement it, the object is copied through serialization.
+
+template <class ObjectType>
+std::shared_ptr<ObjectType> CloneDynamicObject (const std::shared_ptr<const ObjectType>& object)
+{
+	std::shared_ptr<ObjectType> result = object->CreateClone ();
+	if (result != nullptr && typeid (*result) == typeid (*object)) {
+		return result;
+	}
+	return std::shared_ptr<ObjectType> (CloneDynamicObject<ObjectType> (object.get ()));
+}
+
 }
 
 namespace std
@@ -1,8 +1,11 @@
 #include "NE_SingleValues.hpp"
+#include "NE_ValueAllocator.hpp"
 #include "NE_StringUtils.hpp"
 #include "NE_Localization.hpp"
 #include "NE_Debug.hpp"
 
+#include <cmath>
+
 namespace NE
 {
 
@@ -21,7 +24,7 @@ BooleanValue::BooleanValue () :
 BooleanValue::BooleanValue (bool val) :
 	GenericValue<bool> (val)
 {
-
+	AddKind (BooleanValueKind);
 }
 
 BooleanValue::~BooleanValue ()
@@ -29,9 +32,16 @@ BooleanValue::~BooleanValue ()
 
 }
 
+ValueConstPtr BooleanValue::Create (bool val)
+{
+	static const ValueConstPtr trueValue (CreateValue<BooleanValue> (true));
+	static const ValueConstPtr falseValue (CreateValue<BooleanValue> (false));
+	return val ? trueValue : falseValue;
+}
+
 ValuePtr BooleanValue::Clone () const
 {
-	return ValuePtr (new BooleanValue (val));
+	return CreateValue<BooleanValue> (val);
 }
 
 std::wstring BooleanValue::ToString (const StringSettings&) const
@@ -64,7 +74,7 @@ StringValue::StringValue () :
 StringValue::StringValue (const std::wstring& val) :
 	GenericValue<std::wstring> (val)
 {
-
+	AddKind (StringValueKind);
 }
 
 StringValue::~StringValue ()
@@ -98,6 +108,19 @@ Stream::Status StringValue::Write (OutputStream& outputStream) const
 	return outputStream.GetStatus ();
 }
 
+static const NumberValue* GetNumberValue (const Value* val)
+{
+	ValueKind kind = val->GetKind ();
+	if ((kind & DoubleValueKind) != UnknownValueKind) {
+		return static_cast<const DoubleValue*> (val);
+	} else if ((kind & IntValueKind) != UnknownValueKind) {
+		return static_cast<const IntValue*> (val);
+	} else if ((kind & FloatValueKind) != UnknownValueKind) {
+		return static_cast<const FloatValue*> (val);
+	}
+	return dynamic_cast<const NumberValue*> (val);
+}
+
 NumberValue::NumberValue ()
 {
 
@@ -110,47 +133,47 @@ NumberValue::~NumberValue ()
 
 int NumberValue::ToInteger (const ValueConstPtr& val)
 {
-	return Value::Cast<NumberValue> (val)->ToInteger ();
+	return GetNumberValue (val.get ())->ToInteger ();
 }
 
 int NumberValue::ToInteger (const ValuePtr& val)
 {
-	return Value::Cast<NumberValue> (val)->ToInteger ();
+	return GetNumberValue (val.get ())->ToInteger ();
 }
 
 int NumberValue::ToInteger (Value* val)
 {
-	return Value::Cast<NumberValue> (val)->ToInteger ();
+	return GetNumberValue (val)->ToInteger ();
 }
 
 float NumberValue::ToFloat (const ValuePtr& val)
 {
-	return Value::Cast<NumberValue> (val)->ToFloat ();
+	return GetNumberValue (val.get ())->ToFloat ();
 }
 
 float NumberValue::ToFloat (const ValueConstPtr& val)
 {
-	return Value::Cast<NumberValue> (val)->ToFloat ();
+	return GetNumberValue (val.get ())->ToFloat ();
 }
 
 float NumberValue::ToFloat (Value* val)
 {
-	return Value::Cast<NumberValue> (val)->ToFloat ();
+	return GetNumberValue (val)->ToFloat ();
 }
 
 double NumberValue::ToDouble (const ValueConstPtr& val)
 {
-	return Value::Cast<NumberValue> (val)->ToDouble ();
+	return GetNumberValue (val.get ())->ToDouble ();
 }
 
 double NumberValue::ToDouble (const ValuePtr& val)
 {
-	return Value::Cast<NumberValue> (val)->ToDouble ();
+	return GetNumberValue (val.get ())->ToDouble ();
 }
 
 double NumberValue::ToDouble (Value* val)
 {
-	return Value::Cast<NumberValue> (val)->ToDouble ();
+	return GetNumberValue (val)->ToDouble ();
 }
 
 IntValue::IntValue () :
@@ -163,7 +186,7 @@ IntValue::IntValue (int val) :
 	NumberValue (),
 	GenericValue<int> (val)
 {
-
+	AddKind (NumberValueKind | IntValueKind);
 }
 
 IntValue::~IntValue ()
@@ -171,9 +194,21 @@ IntValue::~IntValue ()
 
 }
 
+ValueConstPtr IntValue::Create (int val)
+{
+	static const ValueConstPtr zeroValue (CreateValue<IntValue> (0));
+	static const ValueConstPtr oneValue (CreateValue<IntValue> (1));
+	if (val == 0) {
+		return zeroValue;
+	} else if (val == 1) {
+		return oneValue;
+	}
+	return CreateValue<IntValue> (val);
+}
+
 ValuePtr IntValue::Clone () const
 {
-	return ValuePtr (new IntValue (val));
+	return CreateValue<IntValue> (val);
 }
 
 std::wstring IntValue::ToString (const StringSettings&) const
@@ -222,7 +257,7 @@ FloatValue::FloatValue (float val) :
 	NumberValue (),
 	GenericValue<float> (val)
 {
-
+	AddKind (NumberValueKind | FloatValueKind);
 }
 
 FloatValue::~FloatValue ()
@@ -232,7 +267,7 @@ FloatValue::~FloatValue ()
 
 ValuePtr FloatValue::Clone () const
 {
-	return ValuePtr (new FloatValue (val));
+	return CreateValue<FloatValue> (val);
 }
 
 std::wstring FloatValue::ToString (const StringSettings& stringSettings) const
@@ -281,7 +316,7 @@ DoubleValue::DoubleValue (double val) :
 	NumberValue (),
 	GenericValue<double> (val)
 {
-
+	AddKind (NumberValueKind | DoubleValueKind);
 }
 
 DoubleValue::~DoubleValue ()
@@ -289,9 +324,21 @@ DoubleValue::~DoubleValue ()
 
 }
 
+ValueConstPtr DoubleValue::Create (double val)
+{
+	static const ValueConstPtr zeroValue (CreateValue<DoubleValue> (0.0));
+	static const ValueConstPtr oneValue (CreateValue<DoubleValue> (1.0));
+	if (val == 0.0 && !std::signbit (val)) {
+		return zeroValue;
+	} else if (val == 1.0) {
+		return oneValue;
+	}
+	return CreateValue<DoubleValue> (val);
+}
+
 ValuePtr DoubleValue::Clone () const
 {
-	return ValuePtr (new DoubleValue (val));
+	return CreateValue<DoubleValue> (val);
 }
 
 std::wstring DoubleValue::ToString (const StringSettings& stringSettings) const
@@ -16,6 +16,8 @@ public:
 	BooleanValue (bool val);
 	virtual ~BooleanValue ();
 
+	static ValueConstPtr	Create (bool val);
+
 	virtual ValuePtr		Clone () const override;
 	virtual std::wstring	ToString (const StringSettings& stringSettings) const override;
 
@@ -54,6 +56,8 @@ public:
 	IntValue (int val);
 	virtual ~IntValue ();
 
+	static ValueConstPtr	Create (int val);
+
 	virtual ValuePtr		Clone () const override;
 	virtual std::wstring	ToString (const StringSettings& stringSettings) const override;
 
@@ -96,6 +100,8 @@ public:
 	DoubleValue (double val);
 	virtual ~DoubleValue ();
 
+	static ValueConstPtr	Create (double val);
+
 	virtual ValuePtr		Clone () const override;
 	virtual std::wstring	ToString (const StringSettings& stringSettings) const override;
 
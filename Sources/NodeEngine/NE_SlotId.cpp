@@ -1,18 +1,75 @@
 #include "NE_SlotId.hpp"
 
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+
 namespace NE
 {
 
 SerializationInfo SlotId::serializationInfo (ObjectVersion (1));
 
+class SlotIdEntry
+{
+public:
+	SlotIdEntry (const std::string& id) :
+		id (id),
+		hash (std::hash<std::string> {} (id))
+	{
+
+	}
+
+	const std::string	id;
+	const size_t		hash;
+};
+
+class SlotIdTable
+{
+public:
+	SlotIdTable () :
+		entries (),
+		entriesMutex ()
+	{
+
+	}
+
+	const SlotIdEntry* Intern (const std::string& id)
+	{
+		std::lock_guard<std::mutex> lock (entriesMutex);
+		auto foundEntry = entries.find (id);
+		if (foundEntry != entries.end ()) {
+			return foundEntry->second.get ();
+		}
+		SlotIdEntry* entry = new SlotIdEntry (id);
+		entries.insert ({ id, std::unique_ptr<SlotIdEntry> (entry) });
+		return entry;
+	}
+
+private:
+	std::unordered_map<std::string, std::unique_ptr<SlotIdEntry>>	entries;
+	std::mutex														entriesMutex;
+};
+
+static const SlotIdEntry* InternSlotId (const std::string& id)
+{
+	static SlotIdTable slotIdTable;
+	return slotIdTable.Intern (id);
+}
+
+static const SlotIdEntry* GetEmptySlotIdEntry ()
+{
+	static const SlotIdEntry* emptyEntry = InternSlotId (std::string ());
+	return emptyEntry;
+}
+
 SlotId::SlotId () :
-	id ()
+	entry (GetEmptySlotIdEntry ())
 {
 
 }
 
 SlotId::SlotId (const std::string& id) :
-	id (id)
+	entry (InternSlotId (id))
 {
 
 }
@@ -24,22 +81,22 @@ SlotId::~SlotId ()
 
 size_t SlotId::GenerateHashValue () const
 {
-	return std::hash<std::string> {} (id);
+	return entry->hash;
 }
 
 bool SlotId::operator< (const SlotId& rhs) const
 {
-	return id < rhs.id;
+	return entry != rhs.entry && entry->id < rhs.entry->id;
 }
 
 bool SlotId::operator> (const SlotId& rhs) const
 {
-	return id > rhs.id;
+	return entry != rhs.entry && entry->id > rhs.entry->id;
 }
 
 bool SlotId::operator== (const SlotId& rhs) const
 {
-	return id == rhs.id;
+	return entry == rhs.entry;
 }
 
 bool SlotId::operator!= (const SlotId& rhs) const
@@ -50,14 +107,16 @@ bool SlotId::operator!= (const SlotId& rhs) const
 Stream::Status SlotId::Read (InputStream& inputStream)
 {
 	ObjectHeader header (inputStream);
+	std::string id;
 	inputStream.Read (id);
+	entry = InternSlotId (id);
 	return inputStream.GetStatus ();
 }
 
 Stream::Status SlotId::Write (OutputStream& outputStream) const
 {
 	ObjectHeader header (outputStream, serializationInfo);
-	outputStream.Write (id);
+	outputStream.Write (entry->id);
 	return outputStream.GetStatus ();
 }
 
@@ -8,6 +8,8 @@
 namespace NE
 {
 
+class SlotIdEntry;
+
 class SlotId
 {
 	SERIALIZABLE;
@@ -28,7 +30,7 @@ public:
 	Stream::Status	Write (OutputStream& outputStream) const;
 
 private:
-	std::string id;
+	const SlotIdEntry* entry;
 };
 
 }
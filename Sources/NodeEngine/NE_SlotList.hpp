@@ -8,7 +8,6 @@
 #include "NE_OutputSlot.hpp"
 
 #include <vector>
-#include <unordered_map>
 #include <functional>
 #include <memory>
 
@@ -21,24 +20,28 @@ class SlotList
 public:
 	SlotList ();
 
-	void								Push (const std::shared_ptr<SlotType>& slot);
+	void									Push (const std::shared_ptr<SlotType>& slot);
 	
-	std::shared_ptr<SlotType>			Get (const SlotId& slotId);
-	std::shared_ptr<const SlotType>		Get (const SlotId& slotId) const;
-	bool								Contains (const SlotId& slotId) const;
-	size_t								Count () const;
-	bool								IsEmpty () const;
+	const std::shared_ptr<SlotType>&		Get (const SlotId& slotId);
+	const std::shared_ptr<const SlotType>&	Get (const SlotId& slotId) const;
+	bool									Contains (const SlotId& slotId) const;
+	size_t									Count () const;
+	bool									IsEmpty () const;
 
-	void								Enumerate (const std::function<bool (const std::shared_ptr<SlotType>&)>& processor);
-	void								Enumerate (const std::function<bool (const std::shared_ptr<const SlotType>&)>& processor) const;
+	void									Enumerate (const std::function<bool (const std::shared_ptr<SlotType>&)>& processor);
+	void									Enumerate (const std::function<bool (const std::shared_ptr<const SlotType>&)>& processor) const;
 
 private:
-	std::vector<SlotId>										slotIdList;
-	std::unordered_map<SlotId, std::shared_ptr<SlotType>>	slotIdMap;
+	size_t									Find (const SlotId& slotId) const;
+
+	std::vector<std::shared_ptr<SlotType>>			slots;
+	std::vector<std::shared_ptr<const SlotType>>	constSlots;
 };
 
 template <class SlotType>
-SlotList<SlotType>::SlotList ()
+SlotList<SlotType>::SlotList () :
+	slots (),
+	constSlots ()
 {
 
 }
@@ -46,53 +49,56 @@ SlotList<SlotType>::SlotList ()
 template <class SlotType>
 void SlotList<SlotType>::Push (const std::shared_ptr<SlotType>& slot)
 {
-	slotIdList.push_back (slot->GetId ());
-	slotIdMap.insert ({ slot->GetId (), slot });
+	DBGASSERT (!Contains (slot->GetId ()));
+	slots.push_back (slot);
+	constSlots.push_back (slot);
 }
 
 template <class SlotType>
-std::shared_ptr<SlotType> SlotList<SlotType>::Get (const SlotId& slotId)
+const std::shared_ptr<SlotType>& SlotList<SlotType>::Get (const SlotId& slotId)
 {
-	auto foundSlot = slotIdMap.find (slotId);
-	if (DBGERROR (foundSlot == slotIdMap.end ())) {
-		return nullptr;
+	static const std::shared_ptr<SlotType> noSlot = nullptr;
+	size_t slotIndex = Find (slotId);
+	if (DBGERROR (slotIndex == slots.size ())) {
+		return noSlot;
 	}
-	return foundSlot->second;
+	return slots[slotIndex];
 }
 
 template <class SlotType>
-std::shared_ptr<const SlotType> SlotList<SlotType>::Get (const SlotId& slotId) const
+const std::shared_ptr<const SlotType>& SlotList<SlotType>::Get (const SlotId& slotId) const
 {
-	auto foundSlot = slotIdMap.find (slotId);
-	if (DBGERROR (foundSlot == slotIdMap.end ())) {
-		return nullptr;
+	static const std::shared_ptr<const SlotType> noSlot = nullptr;
+	size_t slotIndex = Find (slotId);
+	if (DBGERROR (slotIndex == constSlots.size ())) {
+		return noSlot;
 	}
-	return foundSlot->second;
+	return constSlots[slotIndex];
 }
 
 template <class SlotType>
 bool SlotList<SlotType>::Contains (const SlotId& slotId) const
 {
-	return slotIdMap.find (slotId) != slotIdMap.end ();
+	return Find (slotId) != slots.size ();
 }
 
 template <class SlotType>
 size_t SlotList<SlotType>::Count () const
 {
-	return slotIdList.size ();
+	return slots.size ();
 }
 
 template <class SlotType>
 bool SlotList<SlotType>::IsEmpty () const
 {
-	return slotIdList.size () == 0;
+	return slots.empty ();
 }
 
 template <class SlotType>
 void SlotList<SlotType>::Enumerate (const std::function<bool (const std::shared_ptr<SlotType>&)>& processor)
 {
-	for (const SlotId& slotId : slotIdList) {
-		if (!processor (Get (slotId))) {
+	for (const std::shared_ptr<SlotType>& slot : slots) {
+		if (!processor (slot)) {
 			break;
 		}
 	}
@@ -101,13 +107,24 @@ void SlotList<SlotType>::Enumerate (const std::function<bool (const std::shared_
 template <class SlotType>
 void SlotList<SlotType>::Enumerate (const std::function<bool (const std::shared_ptr<const SlotType>&)>& processor) const
 {
-	for (const SlotId& slotId : slotIdList) {
-		if (!processor (Get (slotId))) {
+	for (const std::shared_ptr<const SlotType>& slot : constSlots) {
+		if (!processor (slot)) {
 			break;
 		}
 	}
 }
 
+template <class SlotType>
+size_t SlotList<SlotType>::Find (const SlotId& slotId) const
+{
+	for (size_t slotIndex = 0; slotIndex < slots.size (); slotIndex++) {
+		if (slots[slotIndex]->GetId () == slotId) {
+			return slotIndex;
+		}
+	}
+	return slots.size ();
+}
+
 }
 
 #endif
@@ -4,8 +4,31 @@
 namespace NE
 {
 
+template <class Type>
+static Stream::Status ReadItems (InputStream& inputStream, Type* vals, size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		if (inputStream.Read (vals[i]) != Stream::Status::NoError) {
+			break;
+		}
+	}
+	return inputStream.GetStatus ();
+}
+
+template <class Type>
+static Stream::Status WriteItems (OutputStream& outputStream, const Type* vals, size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		if (outputStream.Write (vals[i]) != Stream::Status::NoError) {
+			break;
+		}
+	}
+	return outputStream.GetStatus ();
+}
+
 Stream::Stream () :
-	status (Status::NoError)
+	status (Status::NoError),
+	format (Format::Fixed)
 {
 
 }
@@ -20,8 +43,19 @@ Stream::Status Stream::GetStatus () const
 	return status;
 }
 
+Stream::Format Stream::GetFormat () const
+{
+	return format;
+}
+
+void Stream::SetFormat (Format newFormat)
+{
+	format = newFormat;
+}
+
 InputStream::InputStream () :
-	Stream ()
+	Stream (),
+	identifiers ()
 {
 
 }
@@ -31,8 +65,76 @@ InputStream::~InputStream ()
 
 }
 
+Stream::Status InputStream::ReadArray (int* vals, size_t count)
+{
+	return ReadItems (*this, vals, count);
+}
+
+Stream::Status InputStream::ReadArray (double* vals, size_t count)
+{
+	return ReadItems (*this, vals, count);
+}
+
+Stream::Status InputStream::ReadIdentifier (std::string& val)
+{
+	if (format == Format::Fixed) {
+		return Read (val);
+	}
+
+	size_t identifierIndex = 0;
+	if (ReadIdentifierIndex (identifierIndex) == Status::NoError) {
+		val = identifiers[identifierIndex].name;
+	}
+	return status;
+}
+
+Stream::Status InputStream::ReadIdentifierIndex (size_t& identifierIndex)
+{
+	if (DBGERROR (format != Format::Compact)) {
+		status = Status::Error;
+		return status;
+	}
+
+	size_t index = 0;
+	if (Read (index) != Status::NoError) {
+		return status;
+	}
+
+	if (index == 0) {
+		std::string name;
+		if (Read (name) == Status::NoError) {
+			identifiers.push_back ({ name, nullptr });
+			identifierIndex = identifiers.size () - 1;
+		}
+		return status;
+	}
+
+	if (DBGERROR (index > identifiers.size ())) {
+		status = Status::Error;
+		return status;
+	}
+	identifierIndex = index - 1;
+	return status;
+}
+
+const std::string& InputStream::GetIdentifier (size_t identifierIndex) const
+{
+	return identifiers[identifierIndex].name;
+}
+
+const void* InputStream::GetIdentifierData (size_t identifierIndex) const
+{
+	return identifiers[identifierIndex].data;
+}
+
+void InputStream::SetIdentifierData (size_t identifierIndex, const void* data)
+{
+	identifiers[identifierIndex].data = data;
+}
+
 OutputStream::OutputStream () :
-	Stream ()
+	Stream (),
+	identifiers ()
 {
 
 }
@@ -42,4 +144,31 @@ OutputStream::~OutputStream ()
 
 }
 
+Stream::Status OutputStream::WriteArray (const int* vals, size_t count)
+{
+	return WriteItems (*this, vals, count);
+}
+
+Stream::Status OutputStream::WriteArray (const double* vals, size_t count)
+{
+	return WriteItems (*this, vals, count);
+}
+
+Stream::Status OutputStream::WriteIdentifier (const std::string& val)
+{
+	if (format == Format::Fixed) {
+		return Write (val);
+	}
+
+	auto foundIdentifier = identifiers.find (val);
+	if (foundIdentifier != identifiers.end ()) {
+		return Write (foundIdentifier->second);
+	}
+
+	size_t index = identifiers.size () + 1;
+	identifiers.insert ({ val, index });
+	Write ((size_t) 0);
+	return Write (val);
+}
+
 }
@@ -2,10 +2,17 @@
 #define NE_STREAM_HPP
 
 #include <string>
+#include <vector>
+#include <unordered_map>
 
 namespace NE
 {
 
+// In compact format integers are stored with variable length, and every
+// identifier is stored only once, later occurrences refer to its index.
+// Arrays are stored as their items one after the other in both formats, so
+// derived streams may override the array functions only to copy faster.
+
 class Stream
 {
 public:
@@ -15,13 +22,22 @@ public:
 		Error
 	};
 
+	enum class Format
+	{
+		Fixed,
+		Compact
+	};
+
 	Stream ();
 	virtual ~Stream ();
 
 	Status	GetStatus () const;
+	Format	GetFormat () const;
+	void	SetFormat (Format newFormat);
 
 protected:
 	Status	status;
+	Format	format;
 };
 
 class InputStream : public Stream
@@ -30,16 +46,33 @@ public:
 	InputStream ();
 	virtual ~InputStream ();
 
-	virtual Status	Read (bool& val) = 0;
-	virtual Status	Read (char& val) = 0;
-	virtual Status	Read (unsigned char& val) = 0;
-	virtual Status	Read (short& val) = 0;
-	virtual Status	Read (size_t& val) = 0;
-	virtual Status	Read (int& val) = 0;
-	virtual Status	Read (float& val) = 0;
-	virtual Status	Read (double& val) = 0;
-	virtual Status	Read (std::string& val) = 0;
-	virtual Status	Read (std::wstring& val) = 0;
+	virtual Status		Read (bool& val) = 0;
+	virtual Status		Read (char& val) = 0;
+	virtual Status		Read (unsigned char& val) = 0;
+	virtual Status		Read (short& val) = 0;
+	virtual Status		Read (size_t& val) = 0;
+	virtual Status		Read (int& val) = 0;
+	virtual Status		Read (float& val) = 0;
+	virtual Status		Read (double& val) = 0;
+	virtual Status		Read (std::string& val) = 0;
+	virtual Status		Read (std::wstring& val) = 0;
+
+	virtual Status		ReadArray (int* vals, size_t count);
+	virtual Status		ReadArray (double* vals, size_t count);
+	Status				ReadIdentifier (std::string& val);
+	Status				ReadIdentifierIndex (size_t& identifierIndex);
+	const std::string&	GetIdentifier (size_t identifierIndex) const;
+	const void*			GetIdentifierData (size_t identifierIndex) const;
+	void				SetIdentifierData (size_t identifierIndex, const void* data);
+
+private:
+	struct Identifier
+	{
+		std::string		name;
+		const void*		data;
+	};
+
+	std::vector<Identifier>	identifiers;
 };
 
 class OutputStream : public Stream
@@ -58,6 +91,13 @@ public:
 	virtual Status	Write (const double& val) = 0;
 	virtual Status	Write (const std::string& val) = 0;
 	virtual Status	Write (const std::wstring& val) = 0;
+
+	virtual Status	WriteArray (const int* vals, size_t count);
+	virtual Status	WriteArray (const double* vals, size_t count);
+	Status			WriteIdentifier (const std::string& val);
+
+private:
+	std::unordered_map<std::string, size_t>	identifiers;
 };
 
 template <class EnumType>
@@ -0,0 +1,270 @@
+#include "NE_ThreadPool.hpp"
+#include "NE_Debug.hpp"
+
+#include <algorithm>
+#include <exception>
+
+namespace NE
+{
+
+static thread_local const ThreadPool*	currentThreadPool = nullptr;
+static thread_local size_t				currentWorkerIndex = 0;
+
+class ParallelForRunner : public std::enable_shared_from_this<ParallelForRunner>
+{
+public:
+	ParallelForRunner (size_t count, size_t chunkSize, const std::function<bool (size_t, size_t)>& processor) :
+		count (count),
+		chunkSize (chunkSize),
+		chunkCount ((count + chunkSize - 1) / chunkSize),
+		processor (processor),
+		nextChunkIndex (0),
+		isCanceled (false),
+		finishedChunkCount (0),
+		exception (),
+		finishedMutex (),
+		finishedCondition ()
+	{
+
+	}
+
+	bool Run (ThreadPool& threadPool)
+	{
+		size_t helperCount = (chunkCount > 1 ? std::min (threadPool.GetThreadCount (), chunkCount - 1) : 0);
+		std::shared_ptr<ParallelForRunner> self = shared_from_this ();
+		for (size_t i = 0; i < helperCount; i++) {
+			threadPool.Submit ([self] () {
+				self->ProcessChunks ();
+			});
+		}
+
+		ProcessChunks ();
+		{
+			std::unique_lock<std::mutex> lock (finishedMutex);
+			finishedCondition.wait (lock, [&] () {
+				return finishedChunkCount == chunkCount;
+			});
+		}
+
+		if (exception != nullptr) {
+			std::rethrow_exception (exception);
+		}
+		return !isCanceled;
+	}
+
+private:
+	void ProcessChunks ()
+	{
+		while (true) {
+			size_t chunkIndex = nextChunkIndex.fetch_add (1);
+			if (chunkIndex >= chunkCount) {
+				break;
+			}
+			if (!isCanceled) {
+				ProcessChunk (chunkIndex);
+			}
+			std::lock_guard<std::mutex> lock (finishedMutex);
+			finishedChunkCount += 1;
+			if (finishedChunkCount == chunkCount) {
+				finishedCondition.notify_all ();
+			}
+		}
+	}
+
+	void ProcessChunk (size_t chunkIndex)
+	{
+		size_t begin = chunkIndex * chunkSize;
+		size_t end = std::min (begin + chunkSize, count);
+		try {
+			if (!processor (begin, end)) {
+				isCanceled = true;
+			}
+		} catch (...) {
+			std::lock_guard<std::mutex> lock (finishedMutex);
+			if (exception == nullptr) {
+				exception = std::current_exception ();
+			}
+			isCanceled = true;
+		}
+	}
+
+	size_t									count;
+	size_t									chunkSize;
+	size_t									chunkCount;
+	std::function<bool (size_t, size_t)>	processor;
+	std::atomic<size_t>						nextChunkIndex;
+	std::atomic<bool>						isCanceled;
+	size_t									finishedChunkCount;
+	std::exception_ptr						exception;
+	std::mutex								finishedMutex;
+	std::condition_variable					finishedCondition;
+};
+
+ThreadPool::WorkerQueue::WorkerQueue () :
+	mutex (),
+	tasks ()
+{
+
+}
+
+void ThreadPool::WorkerQueue::PushBack (const Task& task)
+{
+	std::lock_guard<std::mutex> lock (mutex);
+	tasks.push_back (task);
+}
+
+bool ThreadPool::WorkerQueue::PopBack (Task& task)
+{
+	std::lock_guard<std::mutex> lock (mutex);
+	if (tasks.empty ()) {
+		return false;
+	}
+	task = std::move (tasks.back ());
+	tasks.pop_back ();
+	return true;
+}
+
+bool ThreadPool::WorkerQueue::PopFront (Task& task)
+{
+	std::lock_guard<std::mutex> lock (mutex);
+	if (tasks.empty ()) {
+		return false;
+	}
+	task = std::move (tasks.front ());
+	tasks.pop_front ();
+	return true;
+}
+
+ThreadPool::ThreadPool () :
+	ThreadPool (GetDefaultThreadCount ())
+{
+
+}
+
+ThreadPool::ThreadPool (size_t threadCount) :
+	queues (),
+	threads (),
+	wakeMutex (),
+	wakeCondition (),
+	queuedTaskCount (0),
+	nextQueueIndex (0),
+	isStopped (false)
+{
+	Start (std::max (threadCount, (size_t) 1));
+}
+
+ThreadPool::~ThreadPool ()
+{
+	{
+		std::lock_guard<std::mutex> lock (wakeMutex);
+		isStopped = true;
+	}
+	wakeCondition.notify_all ();
+	for (std::thread& thread : threads) {
+		thread.join ();
+	}
+}
+
+size_t ThreadPool::GetThreadCount () const
+{
+	return threads.size ();
+}
+
+bool ThreadPool::IsWorkerThread () const
+{
+	return currentThreadPool == this;
+}
+
+void ThreadPool::Submit (const Task& task)
+{
+	size_t queueIndex = 0;
+	if (currentThreadPool == this) {
+		queueIndex = currentWorkerIndex;
+	} else {
+		queueIndex = nextQueueIndex++ % queues.size ();
+	}
+	queuedTaskCount++;
+	queues[queueIndex]->PushBack (task);
+	{
+		std::lock_guard<std::mutex> lock (wakeMutex);
+	}
+	wakeCondition.notify_one ();
+}
+
+size_t ThreadPool::GetDefaultThreadCount ()
+{
+	size_t hardwareThreadCount = std::thread::hardware_concurrency ();
+	if (hardwareThreadCount == 0) {
+		return 1;
+	}
+	return hardwareThreadCount;
+}
+
+void ThreadPool::Start (size_t threadCount)
+{
+	for (size_t i = 0; i < threadCount; i++) {
+		queues.push_back (std::unique_ptr<WorkerQueue> (new WorkerQueue ()));
+	}
+	for (size_t i = 0; i < threadCount; i++) {
+		threads.push_back (std::thread (&ThreadPool::WorkerMain, this, i));
+	}
+}
+
+bool ThreadPool::GetTask (size_t workerIndex, Task& task)
+{
+	if (queues[workerIndex]->PopBack (task)) {
+		return true;
+	}
+	for (size_t i = 1; i < queues.size (); i++) {
+		size_t victimIndex = (workerIndex + i) % queues.size ();
+		if (queues[victimIndex]->PopFront (task)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void ThreadPool::WorkerMain (size_t workerIndex)
+{
+	currentThreadPool = this;
+	currentWorkerIndex = workerIndex;
+
+	Task task;
+	while (true) {
+		if (GetTask (workerIndex, task)) {
+			queuedTaskCount--;
+			task ();
+			task = nullptr;
+			continue;
+		}
+		std::unique_lock<std::mutex> lock (wakeMutex);
+		wakeCondition.wait (lock, [&] () {
+			return isStopped || queuedTaskCount > 0;
+		});
+		if (isStopped) {
+			break;
+		}
+	}
+
+	currentThreadPool = nullptr;
+}
+
+ThreadPool& GetSharedThreadPool ()
+{
+	static ThreadPool threadPool;
+	return threadPool;
+}
+
+bool ParallelFor (ThreadPool& threadPool, size_t count, size_t chunkSize, const std::function<bool (size_t, size_t)>& processor)
+{
+	if (DBGERROR (chunkSize == 0)) {
+		return false;
+	}
+	if (count == 0) {
+		return true;
+	}
+	std::shared_ptr<ParallelForRunner> runner (new ParallelForRunner (count, chunkSize, processor));
+	return runner->Run (threadPool);
+}
+
+}
@@ -0,0 +1,82 @@
+#ifndef NE_THREADPOOL_HPP
+#define NE_THREADPOOL_HPP
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace NE
+{
+
+// Work-stealing thread pool. Every worker owns a task queue, tasks submitted
+// from a worker thread go to its own queue, and idle workers steal from the
+// other queues. The pool does not track task completion, callers have to
+// synchronize on their own results.
+
+class ThreadPool
+{
+public:
+	using Task = std::function<void ()>;
+
+	ThreadPool ();
+	ThreadPool (size_t threadCount);
+	ThreadPool (const ThreadPool& src) = delete;
+	ThreadPool (ThreadPool&& src) = delete;
+	~ThreadPool ();
+
+	ThreadPool&		operator= (const ThreadPool& rhs) = delete;
+	ThreadPool&		operator= (ThreadPool&& rhs) = delete;
+
+	size_t			GetThreadCount () const;
+	bool			IsWorkerThread () const;
+	void			Submit (const Task& task);
+
+	static size_t	GetDefaultThreadCount ();
+
+private:
+	class WorkerQueue
+	{
+	public:
+		WorkerQueue ();
+
+		void	PushBack (const Task& task);
+		bool	PopBack (Task& task);
+		bool	PopFront (Task& task);
+
+	private:
+		std::mutex			mutex;
+		std::deque<Task>	tasks;
+	};
+
+	void	Start (size_t threadCount);
+	bool	GetTask (size_t workerIndex, Task& task);
+	void	WorkerMain (size_t workerIndex);
+
+	std::vector<std::unique_ptr<WorkerQueue>>	queues;
+	std::vector<std::thread>					threads;
+	std::mutex									wakeMutex;
+	std::condition_variable						wakeCondition;
+	std::atomic<size_t>							queuedTaskCount;
+	std::atomic<size_t>							nextQueueIndex;
+	bool										isStopped;
+};
+
+// The pool shared by every parallel algorithm of the engine.
+
+ThreadPool&		GetSharedThreadPool ();
+
+// Calls the processor for the [begin, end) index ranges of the given chunk
+// size on the pool and on the calling thread. It returns when every started
+// chunk has finished. If the processor returns false or throws, the remaining
+// chunks are skipped, and the first exception is rethrown on the caller.
+
+bool			ParallelFor (ThreadPool& threadPool, size_t count, size_t chunkSize, const std::function<bool (size_t, size_t)>& processor);
+
+}
+
+#endif
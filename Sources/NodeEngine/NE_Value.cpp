@@ -1,6 +1,8 @@
 #include "NE_Value.hpp"
 #include "NE_Debug.hpp"
 
+#include <algorithm>
+
 namespace NE
 {
 
@@ -8,7 +10,8 @@ SerializationInfo			Value::serializationInfo					(ObjectVersion (1));
 SerializationInfo			SingleValue::serializationInfo				(ObjectVersion (1));
 DynamicSerializationInfo	ListValue::serializationInfo				(ObjectId ("{95418CFC-BAE7-4FB3-8ED5-E6EC3AB930AC}"), ObjectVersion (1), ListValue::CreateSerializableInstance);
 
-Value::Value ()
+Value::Value () :
+	kind (UnknownValueKind)
 {
 
 }
@@ -30,9 +33,14 @@ Stream::Status Value::Write (OutputStream& outputStream) const
 	return outputStream.GetStatus ();
 }
 
-SingleValue::SingleValue ()
+void Value::AddKind (ValueKind newKind)
 {
+	kind |= newKind;
+}
 
+SingleValue::SingleValue ()
+{
+	AddKind (SingleValueKind);
 }
 
 SingleValue::~SingleValue ()
@@ -64,15 +72,25 @@ IListValue::~IListValue ()
 
 }
 
-ListValue::ListValue ()
+ListValue::ListValue () :
+	values (),
+	itemKind (~UnknownValueKind),
+	depth (1),
+	flatSize (0)
 {
-
+	AddKind (ListValueKind);
 }
 
 ListValue::ListValue (const std::vector<ValueConstPtr>& values) :
-	values (values)
+	values (values),
+	itemKind (~UnknownValueKind),
+	depth (1),
+	flatSize (0)
 {
-
+	AddKind (ListValueKind);
+	for (const ValueConstPtr& value : values) {
+		AddToSummary (value);
+	}
 }
 
 ListValue::~ListValue ()
@@ -112,6 +130,7 @@ Stream::Status ListValue::Read (InputStream& inputStream)
 		ValuePtr value (ReadDynamicObject<Value> (inputStream));
 		if (DBGVERIFY (value != nullptr)) {
 			values.push_back (value);
+			AddToSummary (value);
 		}
 	}
 	return inputStream.GetStatus ();
@@ -148,6 +167,45 @@ void ListValue::Enumerate (const std::function<void (const ValueConstPtr&)>& pro
 void ListValue::Push (const ValueConstPtr& value)
 {
 	values.push_back (value);
+	AddToSummary (value);
+}
+
+void ListValue::Reserve (size_t count)
+{
+	values.reserve (count);
+}
+
+ValueKind ListValue::GetItemKind () const
+{
+	return itemKind;
+}
+
+size_t ListValue::GetDepth () const
+{
+	return depth;
+}
+
+size_t ListValue::GetFlatSize () const
+{
+	return flatSize;
+}
+
+void ListValue::AddToSummary (const ValueConstPtr& value)
+{
+	const ListValue* listValue = Value::Cast<ListValue> (value.get ());
+	if (listValue == nullptr) {
+		itemKind &= (value != nullptr ? value->GetKind () : UnknownValueKind);
+		flatSize += 1;
+		return;
+	}
+
+	ValueKind listKind = listValue->GetKind ();
+	if (listValue->GetSize () > 0) {
+		listKind |= listValue->GetItemKind ();
+	}
+	itemKind &= listKind;
+	depth = std::max (depth, listValue->GetDepth () + 1);
+	flatSize += listValue->GetFlatSize ();
 }
 
 ValueToListValueAdapter::ValueToListValueAdapter (const ValueConstPtr& val) :
@@ -193,7 +251,7 @@ IListValueConstPtr CreateListValue (const ValueConstPtr& value)
 	if (Value::IsType<SingleValue> (value)) {
 		return IListValueConstPtr (new ValueToListValueAdapter (value));
 	} else if (Value::IsType<ListValue> (value)) {
-		return std::dynamic_pointer_cast<const IListValue> (value);
+		return Value::Cast<ListValue> (value);
 	}
 
 	DBGBREAK ();
@@ -218,7 +276,15 @@ void FlatEnumerate (const ValueConstPtr& value, const std::function<void (const
 
 ValueConstPtr FlattenValue (const ValueConstPtr& value)
 {
+	const ListValue* inputListValue = Value::Cast<ListValue> (value.get ());
+	if (inputListValue != nullptr && inputListValue->GetDepth () == 1 && (inputListValue->GetItemKind () & SingleValueKind) != UnknownValueKind) {
+		return value;
+	}
+
 	ListValuePtr listValue (new ListValue ());
+	if (inputListValue != nullptr) {
+		listValue->Reserve (inputListValue->GetFlatSize ());
+	}
 	FlatEnumerate (value, [&] (const ValueConstPtr& value) {
 		listValue->Push (value);
 	});
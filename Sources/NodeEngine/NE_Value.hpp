@@ -8,10 +8,14 @@
 #include <memory>
 #include <string>
 #include <functional>
+#include <type_traits>
 
 namespace NE
 {
 
+// Values are shared between the threads of the parallel evaluator, so their
+// reference counts must be atomic. Hot paths pass them by const reference.
+
 class Value;
 using ValuePtr = std::shared_ptr<Value>;
 using ValueConstPtr = std::shared_ptr<const Value>;
@@ -28,6 +32,46 @@ class IListValue;
 using IListValuePtr = std::shared_ptr<IListValue>;
 using IListValueConstPtr = std::shared_ptr<const IListValue>;
 
+class BooleanValue;
+class NumberValue;
+class IntValue;
+class FloatValue;
+class DoubleValue;
+class StringValue;
+class IntListValue;
+class DoubleListValue;
+
+using ValueKind = unsigned int;
+
+const ValueKind UnknownValueKind	= 0;
+const ValueKind SingleValueKind		= 1 << 0;
+const ValueKind BooleanValueKind	= 1 << 1;
+const ValueKind NumberValueKind		= 1 << 2;
+const ValueKind IntValueKind		= 1 << 3;
+const ValueKind FloatValueKind		= 1 << 4;
+const ValueKind DoubleValueKind		= 1 << 5;
+const ValueKind StringValueKind		= 1 << 6;
+const ValueKind ListValueKind		= 1 << 7;
+const ValueKind IntListValueKind	= 1 << 8;
+const ValueKind DoubleListValueKind	= 1 << 9;
+
+template <class Type>
+struct ValueKindOf
+{
+	static const ValueKind Kind = UnknownValueKind;
+};
+
+template <> struct ValueKindOf<SingleValue>		{ static const ValueKind Kind = SingleValueKind; };
+template <> struct ValueKindOf<BooleanValue>	{ static const ValueKind Kind = BooleanValueKind; };
+template <> struct ValueKindOf<NumberValue>		{ static const ValueKind Kind = NumberValueKind; };
+template <> struct ValueKindOf<IntValue>		{ static const ValueKind Kind = IntValueKind; };
+template <> struct ValueKindOf<FloatValue>		{ static const ValueKind Kind = FloatValueKind; };
+template <> struct ValueKindOf<DoubleValue>		{ static const ValueKind Kind = DoubleValueKind; };
+template <> struct ValueKindOf<StringValue>		{ static const ValueKind Kind = StringValueKind; };
+template <> struct ValueKindOf<ListValue>		{ static const ValueKind Kind = ListValueKind; };
+template <> struct ValueKindOf<IntListValue>	{ static const ValueKind Kind = IntListValueKind; };
+template <> struct ValueKindOf<DoubleListValue>	{ static const ValueKind Kind = DoubleListValueKind; };
+
 class Value : public DynamicSerializable
 {
 	SERIALIZABLE;
@@ -43,6 +87,8 @@ public:
 	virtual Stream::Status	Read (InputStream& inputStream) override;
 	virtual Stream::Status	Write (OutputStream& outputStream) const override;
 
+	ValueKind				GetKind () const;
+
 	template <class Type>
 	static bool IsType (Value* val);
 
@@ -63,48 +109,112 @@ public:
 
 	template <class Type>
 	static std::shared_ptr<const Type> Cast (const ValueConstPtr& val);
+
+protected:
+	void					AddKind (ValueKind newKind);
+
+private:
+	template <class Type>
+	static bool				IsTypeInternal (const Value* val, std::true_type);
+
+	template <class Type>
+	static bool				IsTypeInternal (const Value* val, std::false_type);
+
+	template <class Type>
+	static const Type*		CastInternal (const Value* val, std::true_type);
+
+	template <class Type>
+	static const Type*		CastInternal (const Value* val, std::false_type);
+
+	template <class Type>
+	using HasKind = std::integral_constant<bool, ValueKindOf<Type>::Kind != UnknownValueKind>;
+
+	template <class Type>
+	using HasDerivedKind = std::integral_constant<bool, ValueKindOf<Type>::Kind != UnknownValueKind && std::is_base_of<Value, Type>::value>;
+
+	ValueKind				kind;
 };
 
+inline ValueKind Value::GetKind () const
+{
+	return kind;
+}
+
 template <class Type>
 bool Value::IsType (Value* val)
 {
-	return dynamic_cast<Type*> (val) != nullptr;
+	return IsTypeInternal<Type> (val, HasKind<Type> ());
 }
 
 template <class Type>
 bool Value::IsType (const ValuePtr& val)
 {
-	return dynamic_cast<Type*> (val.get ()) != nullptr;
+	return IsTypeInternal<Type> (val.get (), HasKind<Type> ());
 }
 
 template <class Type>
 bool Value::IsType (const ValueConstPtr& val)
 {
-	return dynamic_cast<const Type*> (val.get ()) != nullptr;
+	return IsTypeInternal<Type> (val.get (), HasKind<Type> ());
 }
 
 template <class Type>
 Type* Value::Cast (Value* val)
 {
-	return dynamic_cast<Type*> (val);
+	return const_cast<Type*> (CastInternal<Type> (val, HasDerivedKind<Type> ()));
 }
 
 template <class Type>
 const Type* Value::Cast (const Value* val)
 {
-	return dynamic_cast<const Type*> (val);
+	return CastInternal<Type> (val, HasDerivedKind<Type> ());
 }
 
 template <class Type>
 std::shared_ptr<Type> Value::Cast (const ValuePtr& val)
 {
-	return std::dynamic_pointer_cast<Type> (val);
+	Type* result = Cast<Type> (val.get ());
+	if (result == nullptr) {
+		return nullptr;
+	}
+	return std::shared_ptr<Type> (val, result);
 }
 
 template <class Type>
 std::shared_ptr<const Type> Value::Cast (const ValueConstPtr& val)
 {
-	return std::dynamic_pointer_cast<const Type> (val);
+	const Type* result = Cast<Type> (val.get ());
+	if (result == nullptr) {
+		return nullptr;
+	}
+	return std::shared_ptr<const Type> (val, result);
+}
+
+template <class Type>
+bool Value::IsTypeInternal (const Value* val, std::true_type)
+{
+	return val != nullptr && (val->kind & ValueKindOf<Type>::Kind) != UnknownValueKind;
+}
+
+template <class Type>
+bool Value::IsTypeInternal (const Value* val, std::false_type)
+{
+	return dynamic_cast<const Type*> (val) != nullptr;
+}
+
+template <class Type>
+const Type* Value::CastInternal (const Value* val, std::true_type)
+{
+	if (!IsTypeInternal<Type> (val, std::true_type ())) {
+		return nullptr;
+	}
+	return static_cast<const Type*> (val);
+}
+
+template <class Type>
+const Type* Value::CastInternal (const Value* val, std::false_type)
+{
+	return dynamic_cast<const Type*> (val);
 }
 
 class SingleValue : public Value
@@ -149,10 +259,20 @@ public:
 	virtual const ValueConstPtr&	GetValue (size_t index) const override;
 	virtual void					Enumerate (const std::function<void (const ValueConstPtr&)>& processor) const override;
 
-	void							Push (const ValueConstPtr& value);
-	
+	virtual void					Push (const ValueConstPtr& value);
+	void							Reserve (size_t count);
+
+	virtual ValueKind				GetItemKind () const;
+	virtual size_t					GetDepth () const;
+	virtual size_t					GetFlatSize () const;
+
 private:
+	void							AddToSummary (const ValueConstPtr& value);
+
 	std::vector<ValueConstPtr>	values;
+	ValueKind					itemKind;
+	size_t						depth;
+	size_t						flatSize;
 };
 
 class ValueToListValueAdapter : public IListValue
@@ -174,13 +294,15 @@ bool IsSingleType (const ValueConstPtr& val)
 	if (Value::IsType<Type> (val)) {
 		return true;
 	}
-	if (Value::IsType<ListValue> (val)) {
-		const ListValue* listVal = Value::Cast<ListValue> (val.get ());
-		if (listVal->GetSize () == 1 && Value::IsType<Type> (listVal->GetValue (0))) {
-			return true;
-		}
+	const ListValue* listVal = Value::Cast<ListValue> (val.get ());
+	if (listVal == nullptr || listVal->GetSize () != 1) {
+		return false;
 	}
-	return false;
+	const ValueKind typeKind = ValueKindOf<Type>::Kind;
+	if (typeKind != UnknownValueKind && listVal->GetDepth () == 1) {
+		return (listVal->GetItemKind () & typeKind) != UnknownValueKind;
+	}
+	return Value::IsType<Type> (listVal->GetValue (0));
 }
 
 template <class Type>
@@ -189,20 +311,20 @@ bool IsComplexType (const ValueConstPtr& val)
 	if (Value::IsType<Type> (val)) {
 		return true;
 	}
-	if (Value::IsType<ListValue> (val)) {
-		ListValueConstPtr listVal = Value::Cast<ListValue> (val);
-		if (listVal->GetSize () == 0) {
+	const ListValue* listVal = Value::Cast<ListValue> (val.get ());
+	if (listVal == nullptr || listVal->GetSize () == 0) {
+		return false;
+	}
+	const ValueKind typeKind = ValueKindOf<Type>::Kind;
+	if (typeKind != UnknownValueKind) {
+		return (listVal->GetItemKind () & typeKind) != UnknownValueKind;
+	}
+	for (size_t i = 0; i < listVal->GetSize (); i++) {
+		if (!IsComplexType<Type> (listVal->GetValue (i))) {
 			return false;
 		}
-		bool isType = true;
-		listVal->Enumerate ([&] (const ValueConstPtr& innerVal) {
-			if (!IsComplexType<Type> (innerVal)) {
-				isType = false;
-			}
-		});
-		return isType;
 	}
-	return false;
+	return true;
 }
 
 ValueConstPtr		CreateSingleValue (const ValueConstPtr& value);
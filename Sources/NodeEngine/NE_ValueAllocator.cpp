@@ -0,0 +1,241 @@
+#include "NE_ValueAllocator.hpp"
+
+#include <vector>
+#include <mutex>
+#include <new>
+
+namespace NE
+{
+
+static const size_t PoolBlockAlignment = 16;
+static const size_t MaxPoolBlockSize = 256;
+static const size_t PoolCount = MaxPoolBlockSize / PoolBlockAlignment;
+static const size_t PoolChunkSize = 16384;
+static const size_t ThreadCacheBatchSize = 32;
+static const size_t MaxThreadCacheSize = 2 * ThreadCacheBatchSize;
+
+struct FreeBlock
+{
+	FreeBlock* next;
+};
+
+class FreeBlockList
+{
+public:
+	FreeBlockList () :
+		firstFreeBlock (nullptr),
+		freeBlockCount (0)
+	{
+
+	}
+
+	bool IsEmpty () const
+	{
+		return firstFreeBlock == nullptr;
+	}
+
+	size_t GetCount () const
+	{
+		return freeBlockCount;
+	}
+
+	void Push (FreeBlock* block)
+	{
+		block->next = firstFreeBlock;
+		firstFreeBlock = block;
+		freeBlockCount += 1;
+	}
+
+	FreeBlock* Pop ()
+	{
+		FreeBlock* block = firstFreeBlock;
+		firstFreeBlock = block->next;
+		freeBlockCount -= 1;
+		return block;
+	}
+
+private:
+	FreeBlock*	firstFreeBlock;
+	size_t		freeBlockCount;
+};
+
+// The pools are shared by every thread, so they are locked, but threads
+// move blocks between the pools and their own caches only in batches.
+
+class MemoryPool
+{
+public:
+	MemoryPool (size_t blockSize);
+	MemoryPool (const MemoryPool& src) = delete;
+
+	MemoryPool&		operator= (const MemoryPool& rhs) = delete;
+
+	void			Allocate (FreeBlockList& target, size_t count);
+	void			Deallocate (FreeBlockList& source, size_t count);
+
+private:
+	void			AddChunk ();
+
+	size_t				blockSize;
+	FreeBlockList		freeBlocks;
+	std::mutex			mutex;
+};
+
+MemoryPool::MemoryPool (size_t blockSize) :
+	blockSize (blockSize),
+	freeBlocks (),
+	mutex ()
+{
+
+}
+
+void MemoryPool::Allocate (FreeBlockList& target, size_t count)
+{
+	std::lock_guard<std::mutex> lock (mutex);
+	for (size_t i = 0; i < count; i++) {
+		if (freeBlocks.IsEmpty ()) {
+			AddChunk ();
+		}
+		target.Push (freeBlocks.Pop ());
+	}
+}
+
+void MemoryPool::Deallocate (FreeBlockList& source, size_t count)
+{
+	std::lock_guard<std::mutex> lock (mutex);
+	for (size_t i = 0; i < count && !source.IsEmpty (); i++) {
+		freeBlocks.Push (source.Pop ());
+	}
+}
+
+void MemoryPool::AddChunk ()
+{
+	char* chunk = static_cast<char*> (::operator new (PoolChunkSize));
+	size_t blockCount = PoolChunkSize / blockSize;
+	for (size_t i = blockCount; i > 0; i--) {
+		freeBlocks.Push (reinterpret_cast<FreeBlock*> (chunk + (i - 1) * blockSize));
+	}
+}
+
+static size_t GetPoolIndex (size_t size)
+{
+	return (size + PoolBlockAlignment - 1) / PoolBlockAlignment - 1;
+}
+
+static MemoryPool& GetMemoryPool (size_t poolIndex)
+{
+	class MemoryPools
+	{
+	public:
+		MemoryPools () :
+			pools ()
+		{
+			for (size_t blockSize = PoolBlockAlignment; blockSize <= MaxPoolBlockSize; blockSize += PoolBlockAlignment) {
+				pools.push_back (std::unique_ptr<MemoryPool> (new MemoryPool (blockSize)));
+			}
+		}
+
+		MemoryPool& Get (size_t poolIndex)
+		{
+			return *pools[poolIndex];
+		}
+
+	private:
+		std::vector<std::unique_ptr<MemoryPool>> pools;
+	};
+
+	static MemoryPools* memoryPools = new MemoryPools ();
+	return memoryPools->Get (poolIndex);
+}
+
+enum class ThreadCacheState
+{
+	Unused,
+	Active,
+	Released
+};
+
+// The cache lists are trivially destructible, so they can be used during
+// thread exit. The releaser gives the cached blocks back to the pools when
+// the thread ends, after that the thread works on the pools directly.
+
+static thread_local FreeBlockList		threadCaches[PoolCount];
+static thread_local ThreadCacheState	threadCacheState = ThreadCacheState::Unused;
+
+class ThreadCacheReleaser
+{
+public:
+	ThreadCacheReleaser ()
+	{
+		threadCacheState = ThreadCacheState::Active;
+	}
+
+	~ThreadCacheReleaser ()
+	{
+		for (size_t poolIndex = 0; poolIndex < PoolCount; poolIndex++) {
+			GetMemoryPool (poolIndex).Deallocate (threadCaches[poolIndex], threadCaches[poolIndex].GetCount ());
+		}
+		threadCacheState = ThreadCacheState::Released;
+	}
+
+	void Activate ()
+	{
+
+	}
+};
+
+static thread_local ThreadCacheReleaser threadCacheReleaser;
+
+static FreeBlockList* GetThreadCache (size_t poolIndex)
+{
+	if (threadCacheState == ThreadCacheState::Unused) {
+		threadCacheReleaser.Activate ();
+	}
+	if (threadCacheState == ThreadCacheState::Released) {
+		return nullptr;
+	}
+	return &threadCaches[poolIndex];
+}
+
+void* AllocateValueMemory (size_t size)
+{
+	if (size == 0 || size > MaxPoolBlockSize) {
+		return ::operator new (size);
+	}
+	size_t poolIndex = GetPoolIndex (size);
+	FreeBlockList* threadCache = GetThreadCache (poolIndex);
+	if (threadCache == nullptr) {
+		FreeBlockList freeBlocks;
+		GetMemoryPool (poolIndex).Allocate (freeBlocks, 1);
+		return freeBlocks.Pop ();
+	}
+	if (threadCache->IsEmpty ()) {
+		GetMemoryPool (poolIndex).Allocate (*threadCache, ThreadCacheBatchSize);
+	}
+	return threadCache->Pop ();
+}
+
+void DeallocateValueMemory (void* memory, size_t size)
+{
+	if (memory == nullptr) {
+		return;
+	}
+	if (size == 0 || size > MaxPoolBlockSize) {
+		::operator delete (memory);
+		return;
+	}
+	size_t poolIndex = GetPoolIndex (size);
+	FreeBlockList* threadCache = GetThreadCache (poolIndex);
+	if (threadCache == nullptr) {
+		FreeBlockList freeBlocks;
+		freeBlocks.Push (static_cast<FreeBlock*> (memory));
+		GetMemoryPool (poolIndex).Deallocate (freeBlocks, 1);
+		return;
+	}
+	threadCache->Push (static_cast<FreeBlock*> (memory));
+	if (threadCache->GetCount () > MaxThreadCacheSize) {
+		GetMemoryPool (poolIndex).Deallocate (*threadCache, ThreadCacheBatchSize);
+	}
+}
+
+}
@@ -0,0 +1,88 @@
+#ifndef NE_VALUEALLOCATOR_HPP
+#define NE_VALUEALLOCATOR_HPP
+
+#include <memory>
+#include <utility>
+#include <cstddef>
+
+namespace NE
+{
+
+// Small values are allocated from fixed size block pools. The pools keep
+// their memory until the end of the program and reuse released blocks, so
+// creating many short-living values does not hit the global allocator.
+// Every thread caches a few free blocks of each size, so the shared pools
+// are locked only when a cache runs empty or grows too large.
+// The pools are never destroyed, so values can be released safely during
+// static destruction.
+
+void*	AllocateValueMemory (size_t size);
+void	DeallocateValueMemory (void* memory, size_t size);
+
+template <class Type>
+class ValueAllocator
+{
+public:
+	using value_type = Type;
+
+	template <class OtherType>
+	struct rebind
+	{
+		using other = ValueAllocator<OtherType>;
+	};
+
+	ValueAllocator ();
+
+	template <class OtherType>
+	ValueAllocator (const ValueAllocator<OtherType>& src);
+
+	Type*	allocate (size_t count);
+	void	deallocate (Type* memory, size_t count);
+};
+
+template <class Type>
+ValueAllocator<Type>::ValueAllocator ()
+{
+
+}
+
+template <class Type>
+template <class OtherType>
+ValueAllocator<Type>::ValueAllocator (const ValueAllocator<OtherType>&)
+{
+
+}
+
+template <class Type>
+Type* ValueAllocator<Type>::allocate (size_t count)
+{
+	return static_cast<Type*> (AllocateValueMemory (count * sizeof (Type)));
+}
+
+template <class Type>
+void ValueAllocator<Type>::deallocate (Type* memory, size_t count)
+{
+	DeallocateValueMemory (memory, count * sizeof (Type));
+}
+
+template <class Type, class OtherType>
+bool operator== (const ValueAllocator<Type>&, const ValueAllocator<OtherType>&)
+{
+	return true;
+}
+
+template <class Type, class OtherType>
+bool operator!= (const ValueAllocator<Type>&, const ValueAllocator<OtherType>&)
+{
+	return false;
+}
+
+template <class Type, class... Args>
+std::shared_ptr<Type> CreateValue (Args&&... args)
+{
+	return std::allocate_shared<Type> (ValueAllocator<Type> (), std::forward<Args> (args)...);
+}
+
+}
+
+#endif
@@ -1,6 +1,6 @@
 #include "NE_ValueCombination.hpp"
-#include "NE_NodeEngineUtilities.hpp"
 #include "NE_Value.hpp"
+#include "NE_ThreadPool.hpp"
 #include "NE_Debug.hpp"
 
 #include <algorithm>
@@ -8,6 +8,34 @@
 namespace NE
 {
 
+static size_t CalculateCombinationCount (ValueCombinationMode combinationMode, const std::vector<size_t>& valueSizes)
+{
+	if (valueSizes.empty ()) {
+		return 0;
+	}
+
+	size_t combinationCount = 0;
+	switch (combinationMode) {
+		case ValueCombinationMode::Shortest:
+			combinationCount = *std::min_element (valueSizes.begin (), valueSizes.end ());
+			break;
+		case ValueCombinationMode::Longest:
+			combinationCount = *std::max_element (valueSizes.begin (), valueSizes.end ());
+			break;
+		case ValueCombinationMode::CrossProduct:
+			combinationCount = 1;
+			for (size_t valueSize : valueSizes) {
+				combinationCount *= valueSize;
+			}
+			break;
+		default:
+			DBGBREAK ();
+			break;
+	}
+
+	return combinationCount;
+}
+
 ValueCombination::ValueCombination ()
 {
 
@@ -18,149 +46,161 @@ ValueCombination::~ValueCombination ()
 
 }
 
-static bool EnumerateShortestCombinations (	const std::vector<IListValueConstPtr>& values,
-											const std::function<bool (const ValueCombination&)>& processor)
+ValueCombinationIndexIterator::ValueCombinationIndexIterator (ValueCombinationMode combinationMode, const std::vector<size_t>& valueSizes) :
+	combinationMode (combinationMode),
+	valueSizes (valueSizes),
+	indices (valueSizes.size (), 0),
+	combinationIndex (0),
+	combinationCount (CalculateCombinationCount (combinationMode, valueSizes))
 {
-	class ShortestPairValueCombination : public ValueCombination
-	{
-	public:
-		ShortestPairValueCombination (size_t combinationIndex, const std::vector<IListValueConstPtr>& values) :
-			combinationIndex (combinationIndex),
-			values (values)
-		{
 
-		}
+}
 
-		virtual size_t GetSize () const
-		{
-			return values.size ();
-		}
+ValueCombinationIndexIterator::~ValueCombinationIndexIterator ()
+{
 
-		virtual const ValueConstPtr& GetValue (size_t valueIndex) const
-		{
-			return values[valueIndex]->GetValue (combinationIndex);
-		}
+}
 
-	private:
-		size_t									combinationIndex;
-		const std::vector<IListValueConstPtr>&	values;
-	};
+size_t ValueCombinationIndexIterator::GetCombinationCount () const
+{
+	return combinationCount;
+}
 
-	size_t minSize = std::numeric_limits<size_t>::max ();
-	for (const IListValueConstPtr& value : values) {
-		size_t currentSize = value->GetSize ();
-		minSize = std::min (currentSize, minSize);
+size_t ValueCombinationIndexIterator::GetCombinationIndex () const
+{
+	return combinationIndex;
+}
+
+void ValueCombinationIndexIterator::SetCombinationIndex (size_t newCombinationIndex)
+{
+	if (DBGERROR (newCombinationIndex > combinationCount)) {
+		newCombinationIndex = combinationCount;
 	}
 
-	for (size_t combinationIndex = 0; combinationIndex < minSize; ++combinationIndex) {
-		ShortestPairValueCombination valueCombination (combinationIndex, values);
-		if (!processor (valueCombination)) {
-			return false;
+	combinationIndex = newCombinationIndex;
+	if (!HasCombination ()) {
+		return;
+	}
+
+	if (combinationMode == ValueCombinationMode::CrossProduct) {
+		size_t remainingIndex = combinationIndex;
+		for (size_t i = indices.size (); i > 0; i--) {
+			size_t valueIndex = i - 1;
+			indices[valueIndex] = remainingIndex % valueSizes[valueIndex];
+			remainingIndex /= valueSizes[valueIndex];
+		}
+	} else {
+		for (size_t valueIndex = 0; valueIndex < indices.size (); valueIndex++) {
+			indices[valueIndex] = std::min (combinationIndex, valueSizes[valueIndex] - 1);
 		}
 	}
+}
 
-	return true;
+bool ValueCombinationIndexIterator::HasCombination () const
+{
+	return combinationIndex < combinationCount;
 }
 
-static bool EnumerateLongestCombinations (	const std::vector<IListValueConstPtr>& values,
-											const std::function<bool (const ValueCombination&)>& processor)
+void ValueCombinationIndexIterator::Next ()
 {
-	class LongestPairValueCombination : public ValueCombination
-	{
-	public:
-		LongestPairValueCombination (size_t combinationIndex, const std::vector<IListValueConstPtr>& values) :
-			combinationIndex (combinationIndex),
-			values (values)
-		{
+	if (DBGERROR (!HasCombination ())) {
+		return;
+	}
 
-		}
+	combinationIndex += 1;
+	if (!HasCombination ()) {
+		return;
+	}
 
-		virtual size_t GetSize () const
-		{
-			return values.size ();
+	if (combinationMode == ValueCombinationMode::CrossProduct) {
+		for (size_t i = indices.size (); i > 0; i--) {
+			size_t valueIndex = i - 1;
+			if (indices[valueIndex] + 1 < valueSizes[valueIndex]) {
+				indices[valueIndex] += 1;
+				break;
+			}
+			indices[valueIndex] = 0;
 		}
-
-		virtual const ValueConstPtr& GetValue (size_t valueIndex) const
-		{
-			const IListValueConstPtr& value = values[valueIndex];
-			if (combinationIndex < value->GetSize ()) {
-				return value->GetValue (combinationIndex);
-			} else {
-				return value->GetValue (value->GetSize () - 1);
+	} else {
+		for (size_t valueIndex = 0; valueIndex < indices.size (); valueIndex++) {
+			if (combinationIndex < valueSizes[valueIndex]) {
+				indices[valueIndex] = combinationIndex;
 			}
 		}
+	}
+}
+
+size_t ValueCombinationIndexIterator::GetIndex (size_t valueIndex) const
+{
+	return indices[valueIndex];
+}
 
-	private:
-		size_t									combinationIndex;
-		const std::vector<IListValueConstPtr>&	values;
-	};
+const std::vector<size_t>& ValueCombinationIndexIterator::GetIndices () const
+{
+	return indices;
+}
 
-	size_t maxSize = 0;
+static std::vector<size_t> GetValueSizes (const std::vector<IListValueConstPtr>& values)
+{
+	std::vector<size_t> valueSizes;
+	valueSizes.reserve (values.size ());
 	for (const IListValueConstPtr& value : values) {
-		size_t currentSize = value->GetSize ();
-		maxSize = std::max (currentSize, maxSize);
-	}
-	
-	for (size_t combinationIndex = 0; combinationIndex < maxSize; ++combinationIndex) {
-		LongestPairValueCombination valueCombination (combinationIndex, values);
-		if (!processor (valueCombination)) {
-			return false;
-		}
+		valueSizes.push_back (value->GetSize ());
 	}
+	return valueSizes;
+}
+
+ValueCombinationIterator::ValueCombinationIterator (ValueCombinationMode combinationMode, const std::vector<IListValueConstPtr>& values) :
+	ValueCombination (),
+	values (values),
+	indexIterator (combinationMode, GetValueSizes (values))
+{
 
-	return true;
 }
 
-static bool EnumerateCrossProductCombinations (	const std::vector<IListValueConstPtr>& values,
-												const std::function<bool (const ValueCombination&)>& processor)
+ValueCombinationIterator::~ValueCombinationIterator ()
 {
-	class CrossProductValueCombination : public ValueCombination
-	{
-	public:
-		CrossProductValueCombination (const std::vector<IListValueConstPtr>& values, const std::vector<size_t>& indices) :
-			values (values),
-			indices (indices)
-		{
 
-		}
+}
 
-		virtual size_t GetSize () const
-		{
-			return values.size ();
-		}
+size_t ValueCombinationIterator::GetCombinationCount () const
+{
+	return indexIterator.GetCombinationCount ();
+}
 
-		virtual const ValueConstPtr& GetValue (size_t valueIndex) const
-		{
-			return values[valueIndex]->GetValue (indices[valueIndex]);
-		}
+size_t ValueCombinationIterator::GetCombinationIndex () const
+{
+	return indexIterator.GetCombinationIndex ();
+}
 
-	private:
-		const std::vector<IListValueConstPtr>&	values;
-		const std::vector<size_t>&				indices;
-	};
+void ValueCombinationIterator::SetCombinationIndex (size_t newCombinationIndex)
+{
+	indexIterator.SetCombinationIndex (newCombinationIndex);
+}
 
-	std::vector<size_t> maxIndices;
-	for (const IListValueConstPtr& value : values) {
-		if (value->GetSize () == 0) {
-			return false;
-		}
-		maxIndices.push_back (value->GetSize () - 1);
-	}
+bool ValueCombinationIterator::HasCombination () const
+{
+	return indexIterator.HasCombination ();
+}
 
-	bool result = EnumerateVariationIndices (maxIndices,
-		[&] (const std::vector<size_t>& indices) {
-			CrossProductValueCombination valueCombination (values, indices);
-			return processor (valueCombination);
-		}
-	);
+void ValueCombinationIterator::Next ()
+{
+	indexIterator.Next ();
+}
+
+size_t ValueCombinationIterator::GetSize () const
+{
+	return values.size ();
+}
 
-	return result;
+const ValueConstPtr& ValueCombinationIterator::GetValue (size_t index) const
+{
+	return values[index]->GetValue (indexIterator.GetIndex (index));
 }
 
-bool CombineValues (ValueCombinationMode combinationMode, const std::vector<ValueConstPtr>& values,
-					const std::function<bool (const ValueCombination&)>& processor)
+static bool CreateListValues (const std::vector<ValueConstPtr>& values, std::vector<IListValueConstPtr>& listValues)
 {
-	std::vector<IListValueConstPtr> listValues;
+	listValues.reserve (values.size ());
 	for (const ValueConstPtr& value : values) {
 		IListValueConstPtr listValue = CreateListValue (value);
 		if (DBGERROR (listValue == nullptr || listValue->GetSize () == 0)) {
@@ -168,17 +208,60 @@ bool CombineValues (ValueCombinationMode combinationMode, const std::vector<Valu
 		}
 		listValues.push_back (listValue);
 	}
+	return true;
+}
+
+bool CombineValues (ValueCombinationMode combinationMode, const std::vector<ValueConstPtr>& values,
+					const std::function<bool (const ValueCombination&)>& processor)
+{
+	std::vector<IListValueConstPtr> listValues;
+	if (!CreateListValues (values, listValues)) {
+		return false;
+	}
+
+	ValueCombinationIterator combinationIterator (combinationMode, listValues);
+	while (combinationIterator.HasCombination ()) {
+		if (!processor (combinationIterator)) {
+			return false;
+		}
+		combinationIterator.Next ();
+	}
 
-	if (combinationMode == ValueCombinationMode::Shortest) {
-		return EnumerateShortestCombinations (listValues, processor);
-	} else if (combinationMode == ValueCombinationMode::Longest) {
-		return EnumerateLongestCombinations (listValues, processor);
-	} else if (combinationMode == ValueCombinationMode::CrossProduct) {
-		return EnumerateCrossProductCombinations (listValues, processor);
+	return true;
+}
+
+bool CombineValuesParallel (	ValueCombinationMode combinationMode, const std::vector<ValueConstPtr>& values, size_t chunkSize,
+								const std::function<ValueConstPtr (const ValueCombination&)>& processor, std::vector<ValueConstPtr>& results)
+{
+	if (DBGERROR (chunkSize == 0)) {
+		return false;
+	}
+
+	std::vector<IListValueConstPtr> listValues;
+	if (!CreateListValues (values, listValues)) {
+		return false;
 	}
 
-	DBGBREAK ();
-	return false;
+	std::vector<ValueConstPtr> combinationResults (CalculateCombinationCount (combinationMode, GetValueSizes (listValues)));
+	bool succeeded = ParallelFor (GetSharedThreadPool (), combinationResults.size (), chunkSize, [&] (size_t begin, size_t end) {
+		ValueCombinationIterator combinationIterator (combinationMode, listValues);
+		combinationIterator.SetCombinationIndex (begin);
+		for (size_t combinationIndex = begin; combinationIndex < end; combinationIndex++) {
+			ValueConstPtr result = processor (combinationIterator);
+			if (result == nullptr) {
+				return false;
+			}
+			combinationResults[combinationIndex] = result;
+			combinationIterator.Next ();
+		}
+		return true;
+	});
+
+	if (!succeeded) {
+		return false;
+	}
+	results.swap (combinationResults);
+	return true;
 }
 
 }
@@ -26,9 +26,55 @@ public:
 	virtual const ValueConstPtr&	GetValue (size_t index) const = 0;
 };
 
+class ValueCombinationIndexIterator
+{
+public:
+	ValueCombinationIndexIterator (ValueCombinationMode combinationMode, const std::vector<size_t>& valueSizes);
+	~ValueCombinationIndexIterator ();
+
+	size_t						GetCombinationCount () const;
+	size_t						GetCombinationIndex () const;
+	void						SetCombinationIndex (size_t newCombinationIndex);
+	bool						HasCombination () const;
+	void						Next ();
+
+	size_t						GetIndex (size_t valueIndex) const;
+	const std::vector<size_t>&	GetIndices () const;
+
+private:
+	ValueCombinationMode	combinationMode;
+	std::vector<size_t>		valueSizes;
+	std::vector<size_t>		indices;
+	size_t					combinationIndex;
+	size_t					combinationCount;
+};
+
+class ValueCombinationIterator : public ValueCombination
+{
+public:
+	ValueCombinationIterator (ValueCombinationMode combinationMode, const std::vector<IListValueConstPtr>& values);
+	virtual ~ValueCombinationIterator ();
+
+	size_t							GetCombinationCount () const;
+	size_t							GetCombinationIndex () const;
+	void							SetCombinationIndex (size_t newCombinationIndex);
+	bool							HasCombination () const;
+	void							Next ();
+
+	virtual size_t					GetSize () const override;
+	virtual const ValueConstPtr&	GetValue (size_t index) const override;
+
+private:
+	std::vector<IListValueConstPtr>	values;
+	ValueCombinationIndexIterator	indexIterator;
+};
+
 bool CombineValues (ValueCombinationMode combinationMode, const std::vector<ValueConstPtr>& values,
 					const std::function<bool (const ValueCombination&)>& processor);
 
+bool CombineValuesParallel (	ValueCombinationMode combinationMode, const std::vector<ValueConstPtr>& values, size_t chunkSize,
+								const std::function<ValueConstPtr (const ValueCombination&)>& processor, std::vector<ValueConstPtr>& results);
+
 }
 
 #endif
@@ -0,0 +1,37 @@
+#include "AllocationCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<size_t> allocationCounter (0);
+
+void* operator new (size_t size)
+{
+	allocationCounter++;
+	void* ptr = std::malloc (size == 0 ? 1 : size);
+	if (ptr == nullptr) {
+		throw std::bad_alloc ();
+	}
+	return ptr;
+}
+
+void* operator new[] (size_t size)
+{
+	return operator new (size);
+}
+
+void operator delete (void* ptr) noexcept
+{
+	std::free (ptr);
+}
+
+void operator delete[] (void* ptr) noexcept
+{
+	std::free (ptr);
+}
+
+size_t GetAllocationCount ()
+{
+	return allocationCounter;
+}
@@ -0,0 +1,8 @@
+#ifndef ALLOCATIONCOUNTER_HPP
+#define ALLOCATIONCOUNTER_HPP
+
+#include <cstddef>
+
+size_t GetAllocationCount ();
+
+#endif
@@ -2,8 +2,12 @@
 #include "NUIE_NodeUIManager.hpp"
 #include "BI_ArithmeticUINodes.hpp"
 #include "BI_InputUINodes.hpp"
+#include "BI_BuiltInFeatures.hpp"
+#include "NE_NumberListValues.hpp"
 #include "TestUtils.hpp"
 
+#include <cmath>
+
 using namespace NE;
 using namespace NUIE;
 using namespace BI;
@@ -38,4 +42,180 @@ TEST (TestAllArithmeticNodes)
 	ASSERT (IsEqual (DoubleValue::Get (CreateSingleValue (val)), -1.0));
 }
 
+static ValueConstPtr EvaluateBinaryOperation (const UINodePtr& node, ValueCombinationMode combinationMode, const ValueConstPtr& a, const ValueConstPtr& b)
+{
+	node->SetInputSlotDefaultValue (SlotId ("a"), a);
+	node->SetInputSlotDefaultValue (SlotId ("b"), b);
+	GetValueCombinationFeature (node)->SetValueCombinationMode (combinationMode);
+	node->InvalidateValue ();
+	return node->Evaluate (EmptyEvaluationEnv);
+}
+
+static ValuePtr CreateBoxedList (const std::vector<double>& items)
+{
+	ListValuePtr result (new ListValue ());
+	for (double item : items) {
+		result->Push (ValuePtr (new DoubleValue (item)));
+	}
+	return result;
+}
+
+static bool IsEqualResult (const ValueConstPtr& packedResult, const ValueConstPtr& boxedResult)
+{
+	if (packedResult == nullptr || boxedResult == nullptr) {
+		return packedResult == boxedResult;
+	}
+	if (!Value::IsType<DoubleListValue> (packedResult) || !Value::IsType<ListValue> (boxedResult)) {
+		return false;
+	}
+	const DoubleListValue* packedList = Value::Cast<DoubleListValue> (packedResult.get ());
+	const ListValue* boxedList = Value::Cast<ListValue> (boxedResult.get ());
+	if (packedList->GetSize () != boxedList->GetSize ()) {
+		return false;
+	}
+	for (size_t i = 0; i < packedList->GetSize (); i++) {
+		if (packedList->GetItem (i) != DoubleValue::Get (boxedList->GetValue (i))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+TEST (TestPackedArithmeticOperations)
+{
+	TestDrawingEnvironment env;
+	NodeUIManager uiManager (env);
+
+	std::vector<UINodePtr> nodes = {
+		uiManager.AddNode (UINodePtr (new AdditionNode (L"Addition", Point (0, 0))), EmptyEvaluationEnv),
+		uiManager.AddNode (UINodePtr (new SubtractionNode (L"Subtracion", Point (0, 0))), EmptyEvaluationEnv),
+		uiManager.AddNode (UINodePtr (new MultiplicationNode (L"Multiplication", Point (0, 0))), EmptyEvaluationEnv),
+		uiManager.AddNode (UINodePtr (new DivisionNode (L"Division", Point (0, 0))), EmptyEvaluationEnv)
+	};
+
+	std::vector<std::vector<double>> operands = {
+		{ 2.0 },
+		{ 1.0, 2.0, 3.0 },
+		{ 0.5, -1.5, 2.5, 3.5, -4.5 },
+		{ 1.0, 2.0, 0.0, 4.0, 5.0, 6.0, 7.0 }
+	};
+
+	for (const UINodePtr& node : nodes) {
+		for (ValueCombinationMode combinationMode : { ValueCombinationMode::Shortest, ValueCombinationMode::Longest, ValueCombinationMode::CrossProduct }) {
+			for (const std::vector<double>& a : operands) {
+				for (const std::vector<double>& b : operands) {
+					ValueConstPtr packedResult = EvaluateBinaryOperation (node, combinationMode, ValuePtr (new DoubleListValue (a)), ValuePtr (new DoubleListValue (b)));
+					ValueConstPtr boxedResult = EvaluateBinaryOperation (node, combinationMode, CreateBoxedList (a), CreateBoxedList (b));
+					ASSERT (IsEqualResult (packedResult, boxedResult));
+				}
+			}
+			ValueConstPtr packedResult = EvaluateBinaryOperation (node, combinationMode, ValuePtr (new DoubleValue (3.0)), ValuePtr (new DoubleListValue (operands[2])));
+			ValueConstPtr boxedResult = EvaluateBinaryOperation (node, combinationMode, ValuePtr (new DoubleValue (3.0)), CreateBoxedList (operands[2]));
+			ASSERT (IsEqualResult (packedResult, boxedResult));
+		}
+	}
+
+	ASSERT (EvaluateBinaryOperation (nodes[3], ValueCombinationMode::Shortest, ValuePtr (new DoubleListValue (operands[2])), ValuePtr (new DoubleListValue (operands[3]))) == nullptr);
+	ASSERT (EvaluateBinaryOperation (nodes[3], ValueCombinationMode::Shortest, ValuePtr (new DoubleListValue (operands[3])), ValuePtr (new DoubleListValue (operands[2]))) != nullptr);
+}
+
+class PowerNode : public BinaryOperationNode
+{
+	DYNAMIC_SERIALIZABLE (PowerNode);
+
+public:
+	PowerNode () :
+		PowerNode (std::wstring (), Point ())
+	{
+
+	}
+
+	PowerNode (const std::wstring& name, const Point& position) :
+		BinaryOperationNode (name, position)
+	{
+
+	}
+
+private:
+	virtual double DoOperation (double a, double b) const override
+	{
+		return std::pow (a, b);
+	}
+};
+
+DynamicSerializationInfo PowerNode::serializationInfo (ObjectId ("{5D0E9A3B-7C41-4B8E-A2F6-1E93C8D7B405}"), ObjectVersion (1), PowerNode::CreateSerializableInstance);
+
+TEST (DefaultListOperationTest)
+{
+	TestDrawingEnvironment env;
+	NodeUIManager uiManager (env);
+	UINodePtr node = uiManager.AddNode (UINodePtr (new PowerNode (L"Power", Point (0, 0))), EmptyEvaluationEnv);
+
+	std::vector<double> a = { 1.0, 2.0, 3.0 };
+	std::vector<double> b = { 2.0, 0.5, 3.0, 4.0, -1.0 };
+	for (ValueCombinationMode combinationMode : { ValueCombinationMode::Shortest, ValueCombinationMode::Longest, ValueCombinationMode::CrossProduct }) {
+		ValueConstPtr packedResult = EvaluateBinaryOperation (node, combinationMode, ValuePtr (new DoubleListValue (a)), ValuePtr (new DoubleListValue (b)));
+		ValueConstPtr boxedResult = EvaluateBinaryOperation (node, combinationMode, CreateBoxedList (a), CreateBoxedList (b));
+		ASSERT (packedResult != nullptr);
+		ASSERT (IsEqualResult (packedResult, boxedResult));
+	}
+
+	ASSERT (EvaluateBinaryOperation (node, ValueCombinationMode::Longest, ValuePtr (new DoubleListValue ({ 0.0 })), ValuePtr (new DoubleListValue (b))) == nullptr);
+}
+
+TEST (CloneArithmeticNodeTest)
+{
+	TestDrawingEnvironment env;
+	NodeUIManager uiManager (env);
+
+	UINodePtr val = uiManager.AddNode (UINodePtr (new DoubleUpDownNode (L"Value", Point (0, 0), 3.0, 1.0)), EmptyEvaluationEnv);
+	UINodePtr add = uiManager.AddNode (UINodePtr (new AdditionNode (L"Addition", Point (10, 20))), EmptyEvaluationEnv);
+	uiManager.ConnectOutputSlotToInputSlot (val->GetUIOutputSlot (NE::SlotId ("out")), add->GetUIInputSlot (NE::SlotId ("a")));
+
+	NodePtr clonedVal = Node::Clone (val);
+	ASSERT (Node::IsType<DoubleUpDownNode> (clonedVal));
+	ASSERT (Node::IsEqual (val, clonedVal));
+	ASSERT (Node::Cast<DoubleUpDownNode> (clonedVal)->GetValue () == 3.0);
+
+	NodePtr clonedNode = Node::Clone (add);
+	ASSERT (Node::IsType<AdditionNode> (clonedNode));
+	ASSERT (Node::IsEqual (add, clonedNode));
+	UINodePtr clonedAdd = Node::Cast<UINode> (clonedNode);
+	ASSERT (clonedAdd->GetId () == add->GetId ());
+	ASSERT (clonedAdd->GetNodeName () == L"Addition");
+	ASSERT (IsEqual (clonedAdd->GetNodePosition (), Point (10, 20)));
+	ASSERT (clonedAdd->GetInputSlotCount () == add->GetInputSlotCount ());
+	ASSERT (clonedAdd->GetUIInputSlot (NE::SlotId ("a")) != add->GetUIInputSlot (NE::SlotId ("a")));
+	ASSERT (clonedAdd->GetUIInputSlot (NE::SlotId ("a"))->GetOwnerNodeId () == add->GetId ());
+
+	std::shared_ptr<ValueCombinationFeature> feature = GetValueCombinationFeature (add);
+	std::shared_ptr<ValueCombinationFeature> clonedFeature = GetValueCombinationFeature (clonedAdd);
+	ASSERT (clonedFeature != feature);
+	ASSERT (clonedFeature->GetValueCombinationMode () == ValueCombinationMode::Longest);
+	clonedFeature->SetValueCombinationMode (ValueCombinationMode::CrossProduct);
+	ASSERT (feature->GetValueCombinationMode () == ValueCombinationMode::Longest);
+}
+
+
+TEST (FeatureChangeContentHashTest)
+{
+	TestDrawingEnvironment env;
+	NodeUIManager uiManager (env);
+
+	UINodePtr add = uiManager.AddNode (UINodePtr (new AdditionNode (L"Addition", Point (0, 0))), EmptyEvaluationEnv);
+	NodePtr clonedAdd = Node::Clone (add);
+	uint64_t originalHash = add->GetContentHash ();
+	ASSERT (Node::IsEqual (add, clonedAdd));
+
+	GetValueCombinationFeature (add)->SetValueCombinationMode (ValueCombinationMode::CrossProduct);
+	add->OnFeatureChange (ValueCombinationFeatureId, EmptyEvaluationEnv);
+	ASSERT (add->GetContentHash () != originalHash);
+	ASSERT (!Node::IsEqual (add, clonedAdd));
+
+	GetValueCombinationFeature (add)->SetValueCombinationMode (ValueCombinationMode::Longest);
+	add->OnFeatureChange (ValueCombinationFeatureId, EmptyEvaluationEnv);
+	ASSERT (add->GetContentHash () == originalHash);
+	ASSERT (Node::IsEqual (add, clonedAdd));
+}
+
 }
@@ -0,0 +1,110 @@
+#include "SimpleTest.hpp"
+#include "NE_Compression.hpp"
+
+#include <string>
+
+using namespace NE;
+
+namespace CompressionTest
+{
+
+static bool CheckRoundTrip (const std::vector<char>& data)
+{
+	std::vector<char> compressed;
+	std::vector<char> decompressed;
+	CompressData (data, compressed);
+	if (!DecompressData (compressed, decompressed)) {
+		return false;
+	}
+	return decompressed == data;
+}
+
+TEST (CompressRoundTripTest)
+{
+	ASSERT (CheckRoundTrip (std::vector<char> ()));
+	ASSERT (CheckRoundTrip (std::vector<char> ({ 'a' })));
+	ASSERT (CheckRoundTrip (std::vector<char> ({ 'a', 'b', 'c', 'd' })));
+	ASSERT (CheckRoundTrip (std::vector<char> (1000, 'x')));
+
+	std::vector<char> randomData;
+	unsigned int seed = 12345;
+	for (size_t i = 0; i < 100000; i++) {
+		seed = seed * 1103515245 + 12345;
+		randomData.push_back ((char) (seed >> 16));
+	}
+	ASSERT (CheckRoundTrip (randomData));
+
+	std::vector<char> mixedData;
+	for (size_t i = 0; i < 1000; i++) {
+		std::string text = "Node" + std::to_string (i) + "Position";
+		mixedData.insert (mixedData.end (), text.begin (), text.end ());
+		mixedData.push_back ((char) (i % 7));
+	}
+	ASSERT (CheckRoundTrip (mixedData));
+}
+
+TEST (CompressRepetitiveDataTest)
+{
+	std::vector<char> data;
+	for (size_t i = 0; i < 10000; i++) {
+		std::string text = "NodeEditor";
+		data.insert (data.end (), text.begin (), text.end ());
+	}
+
+	std::vector<char> compressed;
+	CompressData (data, compressed);
+	ASSERT (compressed.size () * 10 < data.size ());
+
+	std::vector<char> decompressed;
+	ASSERT (DecompressData (compressed, decompressed));
+	ASSERT (decompressed == data);
+}
+
+TEST (DecompressInvalidDataTest)
+{
+	std::vector<char> data (1000, 'x');
+	std::vector<char> compressed;
+	CompressData (data, compressed);
+
+	std::vector<char> decompressed;
+	std::vector<char> truncated (compressed.begin (), compressed.end () - 1);
+	ASSERT (!DecompressData (truncated, decompressed));
+	ASSERT (!DecompressData (std::vector<char> ({ (char) 10, (char) 0, (char) 5, (char) 20 }), decompressed));
+
+	std::vector<char> hugeSize ({ (char) 0x80, (char) 0x80, (char) 0x80, (char) 0x80, (char) 0x80, (char) 0x80, (char) 0x80, (char) 0x80, (char) 0x40, (char) 1, 'a' });
+	ASSERT (!DecompressData (hugeSize, decompressed));
+	std::vector<char> wrongSize ({ (char) 100, (char) 1, 'a', (char) 0, (char) 1 });
+	ASSERT (!DecompressData (wrongSize, decompressed));
+	std::vector<char> overflowingMatch ({ (char) 10, (char) 1, 'a', (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0x01, (char) 1 });
+	ASSERT (!DecompressData (overflowingMatch, decompressed));
+}
+
+TEST (CompressedBufferTest)
+{
+	std::vector<char> data (1000, 'x');
+
+	CompressedBuffer rawBuffer;
+	rawBuffer.Set (data, CompressionMode::None);
+	ASSERT (!rawBuffer.IsCompressed ());
+	ASSERT (rawBuffer.GetSize () == data.size ());
+
+	CompressedBuffer compressedBuffer;
+	compressedBuffer.Set (data, CompressionMode::LZ);
+	ASSERT (compressedBuffer.IsCompressed ());
+	ASSERT (compressedBuffer.GetSize () < data.size ());
+
+	std::vector<char> result;
+	ASSERT (rawBuffer.Get (result));
+	ASSERT (result == data);
+	ASSERT (compressedBuffer.Get (result));
+	ASSERT (result == data);
+
+	std::vector<char> shortData ({ 'a', 'b' });
+	CompressedBuffer shortBuffer;
+	shortBuffer.Set (shortData, CompressionMode::LZ);
+	ASSERT (!shortBuffer.IsCompressed ());
+	ASSERT (shortBuffer.Get (result));
+	ASSERT (result == shortData);
+}
+
+}
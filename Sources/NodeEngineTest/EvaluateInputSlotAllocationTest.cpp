@@ -0,0 +1,74 @@
+#include "SimpleTest.hpp"
+#include "NE_NodeManager.hpp"
+#include "NE_Node.hpp"
+#include "NE_InputSlot.hpp"
+#include "NE_OutputSlot.hpp"
+#include "NE_SingleValues.hpp"
+#include "TestNodes.hpp"
+#include "AllocationCounter.hpp"
+
+using namespace NE;
+
+namespace EvaluateInputSlotAllocationTest
+{
+
+class IncreaseNode : public SerializableTestNode
+{
+public:
+	IncreaseNode () :
+		SerializableTestNode ()
+	{
+
+	}
+
+	virtual void Initialize () override
+	{
+		RegisterInputSlot (InputSlotPtr (new InputSlot (SlotId ("in"), ValuePtr (new IntValue (0)), OutputSlotConnectionMode::Single)));
+		RegisterOutputSlot (OutputSlotPtr (new OutputSlot (SlotId ("out"))));
+	}
+
+	virtual ValueConstPtr Calculate (NE::EvaluationEnv& env) const override
+	{
+		ValueConstPtr in = EvaluateInputSlot (SlotId ("in"), env);
+		return ValuePtr (new IntValue (IntValue::Get (in) + 1));
+	}
+};
+
+static size_t CountEvaluationAllocations (NodeManager& manager, const std::vector<NodePtr>& nodesToInvalidate)
+{
+	for (const NodePtr& node : nodesToInvalidate) {
+		node->InvalidateValue ();
+	}
+	size_t allocationsBefore = GetAllocationCount ();
+	manager.EvaluateAllNodes (EmptyEvaluationEnv);
+	return GetAllocationCount () - allocationsBefore;
+}
+
+TEST (SingleInputSlotAllocationTest)
+{
+	const size_t nodeCount = 1000;
+
+	NodeManager chainManager;
+	NodeManager separateManager;
+	std::vector<NodePtr> chainNodes;
+	std::vector<NodePtr> separateNodes;
+	for (size_t i = 0; i < nodeCount; i++) {
+		chainNodes.push_back (chainManager.AddNode (NodePtr (new IncreaseNode ())));
+		separateNodes.push_back (separateManager.AddNode (NodePtr (new IncreaseNode ())));
+		if (i > 0) {
+			chainManager.ConnectOutputSlotToInputSlot (chainNodes[i - 1]->GetOutputSlot (SlotId ("out")), chainNodes[i]->GetInputSlot (SlotId ("in")));
+		}
+	}
+
+	chainManager.EvaluateAllNodes (EmptyEvaluationEnv);
+	separateManager.EvaluateAllNodes (EmptyEvaluationEnv);
+	ASSERT (IntValue::Get (chainNodes.back ()->GetCalculatedValue ()) == (int) nodeCount);
+	ASSERT (IntValue::Get (separateNodes.back ()->GetCalculatedValue ()) == 1);
+
+	size_t chainAllocations = CountEvaluationAllocations (chainManager, { chainNodes.front () });
+	size_t separateAllocations = CountEvaluationAllocations (separateManager, separateNodes);
+	ASSERT (IntValue::Get (chainNodes.back ()->GetCalculatedValue ()) == (int) nodeCount);
+	ASSERT (chainAllocations == separateAllocations);
+}
+
+}
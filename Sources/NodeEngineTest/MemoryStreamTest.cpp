@@ -4,6 +4,9 @@
 #include "NE_MemoryStream.hpp"
 
 #include <memory>
+#include <fstream>
+#include <limits>
+#include <cstdio>
 
 using namespace NE;
 
@@ -65,4 +68,200 @@ TEST (TypeTest)
 	ASSERT (enumVal == TestEnum::A);
 }
 
+TEST (ExternalBufferTest)
+{
+	MemoryOutputStream outputStream;
+	outputStream.Write ((int) 5);
+	outputStream.Write (std::wstring (L"apple"));
+
+	const std::vector<char>& buffer = outputStream.GetBuffer ();
+	MemoryInputStream inputStream (buffer.data (), buffer.size ());
+	int intVal = 0;
+	std::wstring wStringVal;
+	ASSERT (inputStream.Read (intVal) == Stream::Status::NoError);
+	ASSERT (inputStream.Read (wStringVal) == Stream::Status::NoError);
+	ASSERT (intVal == 5);
+	ASSERT (wStringVal == L"apple");
+}
+
+TEST (MappedFileTest)
+{
+	MemoryOutputStream outputStream;
+	outputStream.Write (std::string ("apple"));
+	outputStream.Write ((double) 3.0);
+
+	const std::string fileName = "MappedFileTest.bin";
+	{
+		const std::vector<char>& buffer = outputStream.GetBuffer ();
+		std::ofstream file (fileName, std::ios::binary);
+		file.write (buffer.data (), buffer.size ());
+	}
+
+	{
+		MappedFileInputStream inputStream (L"MappedFileTest.bin");
+		std::string stringVal;
+		double doubleVal = 0.0;
+		ASSERT (inputStream.GetStatus () == Stream::Status::NoError);
+		ASSERT (inputStream.Read (stringVal) == Stream::Status::NoError);
+		ASSERT (inputStream.Read (doubleVal) == Stream::Status::NoError);
+		ASSERT (stringVal == "apple");
+		ASSERT (doubleVal == 3.0);
+	}
+
+	std::remove (fileName.c_str ());
+}
+
+TEST (BulkWriteTest)
+{
+	const std::string longString (100000, 'a');
+
+	MemoryOutputStream outputStream;
+	outputStream.Reserve (sizeof (size_t) + longString.length () + sizeof (double));
+	const char* bufferData = outputStream.GetBuffer ().data ();
+	ASSERT (outputStream.GetSize () == 0);
+	ASSERT (outputStream.Write (longString) == Stream::Status::NoError);
+	ASSERT (outputStream.Write ((double) 3.0) == Stream::Status::NoError);
+	ASSERT (outputStream.GetSize () == sizeof (size_t) + longString.length () + sizeof (double));
+	ASSERT (outputStream.GetBuffer ().data () == bufferData);
+
+	MemoryInputStream inputStream (outputStream.GetBuffer ());
+	std::string stringVal;
+	double doubleVal = 0.0;
+	ASSERT (inputStream.Read (stringVal) == Stream::Status::NoError);
+	ASSERT (inputStream.Read (doubleVal) == Stream::Status::NoError);
+	ASSERT (stringVal == longString);
+	ASSERT (doubleVal == 3.0);
+}
+
+TEST (CompactFormatTest)
+{
+	MemoryOutputStream outputStream;
+	outputStream.SetFormat (Stream::Format::Compact);
+	ASSERT (outputStream.Write ((size_t) 5) == Stream::Status::NoError);
+	ASSERT (outputStream.GetSize () == 1);
+	ASSERT (outputStream.Write ((size_t) 300) == Stream::Status::NoError);
+	ASSERT (outputStream.GetSize () == 3);
+	ASSERT (outputStream.Write ((int) -1) == Stream::Status::NoError);
+	ASSERT (outputStream.GetSize () == 4);
+	ASSERT (outputStream.Write (std::numeric_limits<size_t>::max ()) == Stream::Status::NoError);
+	ASSERT (outputStream.Write (std::numeric_limits<int>::min ()) == Stream::Status::NoError);
+	ASSERT (outputStream.Write (std::numeric_limits<int>::max ()) == Stream::Status::NoError);
+	ASSERT (outputStream.Write (std::wstring (L"banana")) == Stream::Status::NoError);
+	ASSERT (outputStream.Write ((double) 3.0) == Stream::Status::NoError);
+
+	MemoryInputStream inputStream (outputStream.GetBuffer ());
+	inputStream.SetFormat (Stream::Format::Compact);
+	size_t sizeVal1 = 0;
+	size_t sizeVal2 = 0;
+	int intVal1 = 0;
+	size_t sizeVal3 = 0;
+	int intVal2 = 0;
+	int intVal3 = 0;
+	std::wstring wStringVal;
+	double doubleVal = 0.0;
+	ASSERT (inputStream.Read (sizeVal1) == Stream::Status::NoError);
+	ASSERT (inputStream.Read (sizeVal2) == Stream::Status::NoError);
+	ASSERT (inputStream.Read (intVal1) == Stream::Status::NoError);
+	ASSERT (inputStream.Read (sizeVal3) == Stream::Status::NoError);
+	ASSERT (inputStream.Read (intVal2) == Stream::Status::NoError);
+	ASSERT (inputStream.Read (intVal3) == Stream::Status::NoError);
+	ASSERT (inputStream.Read (wStringVal) == Stream::Status::NoError);
+	ASSERT (inputStream.Read (doubleVal) == Stream::Status::NoError);
+	ASSERT (sizeVal1 == 5);
+	ASSERT (sizeVal2 == 300);
+	ASSERT (intVal1 == -1);
+	ASSERT (sizeVal3 == std::numeric_limits<size_t>::max ());
+	ASSERT (intVal2 == std::numeric_limits<int>::min ());
+	ASSERT (intVal3 == std::numeric_limits<int>::max ());
+	ASSERT (wStringVal == L"banana");
+	ASSERT (doubleVal == 3.0);
+}
+
+TEST (IdentifierTest)
+{
+	for (Stream::Format format : { Stream::Format::Fixed, Stream::Format::Compact }) {
+		MemoryOutputStream outputStream;
+		outputStream.SetFormat (format);
+		ASSERT (outputStream.WriteIdentifier ("apple") == Stream::Status::NoError);
+		ASSERT (outputStream.WriteIdentifier ("banana") == Stream::Status::NoError);
+		size_t sizeBeforeRepeat = outputStream.GetSize ();
+		ASSERT (outputStream.WriteIdentifier ("apple") == Stream::Status::NoError);
+		if (format == Stream::Format::Compact) {
+			ASSERT (outputStream.GetSize () == sizeBeforeRepeat + 1);
+		}
+
+		MemoryInputStream inputStream (outputStream.GetBuffer ());
+		inputStream.SetFormat (format);
+		std::string identifier1;
+		std::string identifier2;
+		std::string identifier3;
+		ASSERT (inputStream.ReadIdentifier (identifier1) == Stream::Status::NoError);
+		ASSERT (inputStream.ReadIdentifier (identifier2) == Stream::Status::NoError);
+		ASSERT (inputStream.ReadIdentifier (identifier3) == Stream::Status::NoError);
+		ASSERT (identifier1 == "apple");
+		ASSERT (identifier2 == "banana");
+		ASSERT (identifier3 == "apple");
+	}
+}
+
+static std::vector<char> WriteTestArrays (Stream::Format format, bool useDefault)
+{
+	std::vector<int> ints ({ -1, 0, 1, 1000000 });
+	std::vector<double> doubles ({ -1.5, 0.0, 2.5 });
+
+	MemoryOutputStream outputStream;
+	outputStream.SetFormat (format);
+	if (useDefault) {
+		outputStream.OutputStream::WriteArray (ints.data (), ints.size ());
+		outputStream.OutputStream::WriteArray (doubles.data (), doubles.size ());
+	} else {
+		outputStream.WriteArray (ints.data (), ints.size ());
+		outputStream.WriteArray (doubles.data (), doubles.size ());
+	}
+	outputStream.Write (ints.size ());
+	return outputStream.GetBuffer ();
+}
+
+static bool ReadTestArrays (const std::vector<char>& buffer, Stream::Format format, bool useDefault)
+{
+	MemoryInputStream inputStream (buffer);
+	inputStream.SetFormat (format);
+	std::vector<int> readInts (4);
+	std::vector<double> readDoubles (3);
+	if (useDefault) {
+		inputStream.InputStream::ReadArray (readInts.data (), readInts.size ());
+		inputStream.InputStream::ReadArray (readDoubles.data (), readDoubles.size ());
+	} else {
+		inputStream.ReadArray (readInts.data (), readInts.size ());
+		inputStream.ReadArray (readDoubles.data (), readDoubles.size ());
+	}
+	size_t intCount = 0;
+	inputStream.Read (intCount);
+	if (inputStream.GetStatus () != Stream::Status::NoError) {
+		return false;
+	}
+	return readInts == std::vector<int> ({ -1, 0, 1, 1000000 }) && readDoubles == std::vector<double> ({ -1.5, 0.0, 2.5 }) && intCount == 4;
+}
+
+TEST (ArrayTest)
+{
+	std::vector<Stream::Format> formats = { Stream::Format::Fixed, Stream::Format::Compact };
+	for (Stream::Format format : formats) {
+		ASSERT (ReadTestArrays (WriteTestArrays (format, false), format, false));
+		ASSERT (ReadTestArrays (WriteTestArrays (format, true), format, true));
+		ASSERT (WriteTestArrays (format, false) == WriteTestArrays (format, true));
+	}
+	ASSERT (WriteTestArrays (Stream::Format::Fixed, false).size () == 4 * sizeof (int) + 3 * sizeof (double) + sizeof (size_t));
+	ASSERT (WriteTestArrays (Stream::Format::Compact, false).size () < WriteTestArrays (Stream::Format::Fixed, false).size ());
+}
+
+TEST (DefaultArrayTest)
+{
+	std::vector<Stream::Format> formats = { Stream::Format::Fixed, Stream::Format::Compact };
+	for (Stream::Format format : formats) {
+		ASSERT (ReadTestArrays (WriteTestArrays (format, true), format, false));
+		ASSERT (ReadTestArrays (WriteTestArrays (format, false), format, true));
+	}
+}
+
 }
@@ -657,6 +657,43 @@ TEST (CycleDetectionTest3)
 	ASSERT (!manager.ConnectOutputSlotToInputSlot (node3->GetOutputSlot (SlotId ("out")), node1->GetInputSlot (SlotId ("in"))));
 }
 
+TEST (CycleDetectionTest4)
+{
+	NodeManager manager;
+
+	const size_t layerCount = 15;
+	const size_t layerWidth = 3;
+	std::vector<std::vector<NodePtr>> layers;
+	for (size_t i = 0; i < layerCount; ++i) {
+		layers.push_back (std::vector<NodePtr> ());
+		for (size_t j = 0; j < layerWidth; ++j) {
+			NodePtr node = manager.AddNode (NodePtr (new MultiAdditionNode ()));
+			if (i > 0) {
+				for (const NodePtr& prevNode : layers[i - 1]) {
+					ASSERT (manager.ConnectOutputSlotToInputSlot (prevNode->GetOutputSlot (SlotId ("out")), node->GetInputSlot (SlotId ("in"))));
+				}
+			}
+			layers[i].push_back (node);
+		}
+	}
+
+	NodePtr firstNode = layers.front ().front ();
+	NodePtr lastNode = layers.back ().back ();
+	ASSERT (!manager.CanConnectOutputSlotToInputSlot (lastNode->GetOutputSlot (SlotId ("out")), firstNode->GetInputSlot (SlotId ("in"))));
+	ASSERT (manager.CanConnectOutputSlotToInputSlot (firstNode->GetOutputSlot (SlotId ("out")), lastNode->GetInputSlot (SlotId ("in"))));
+
+	manager.EvaluateAllNodes (NE::EmptyEvaluationEnv);
+	ASSERT (!manager.CanConnectOutputSlotToInputSlot (lastNode->GetOutputSlot (SlotId ("out")), firstNode->GetInputSlot (SlotId ("in"))));
+	ASSERT (manager.CanConnectOutputSlotToInputSlot (firstNode->GetOutputSlot (SlotId ("out")), lastNode->GetInputSlot (SlotId ("in"))));
+
+	NodePtr otherNode = manager.AddNode (NodePtr (new MultiAdditionNode ()));
+	manager.EvaluateAllNodes (NE::EmptyEvaluationEnv);
+	ASSERT (manager.ConnectOutputSlotToInputSlot (lastNode->GetOutputSlot (SlotId ("out")), otherNode->GetInputSlot (SlotId ("in"))));
+	ASSERT (!manager.CanConnectOutputSlotToInputSlot (otherNode->GetOutputSlot (SlotId ("out")), firstNode->GetInputSlot (SlotId ("in"))));
+	ASSERT (manager.ConnectOutputSlotToInputSlot (firstNode->GetOutputSlot (SlotId ("out")), otherNode->GetInputSlot (SlotId ("in"))));
+	ASSERT (!manager.CanConnectOutputSlotToInputSlot (otherNode->GetOutputSlot (SlotId ("out")), layers[1][1]->GetInputSlot (SlotId ("in"))));
+}
+
 TEST (HasConnectionTest)
 {
 	NodeManager manager;
@@ -1,8 +1,13 @@
 #include "SimpleTest.hpp"
 #include "NE_MemoryStream.hpp"
 #include "NUIE_NodeEditor.hpp"
+#include "NUIE_Version.hpp"
 #include "BI_InputUINodes.hpp"
 #include "VisualTestFramework.hpp"
+#include "TestUtils.hpp"
+
+#include <cstdio>
+#include <fstream>
 
 using namespace NE;
 using namespace NUIE;
@@ -35,4 +40,94 @@ TEST (NodeEditorNeedToSaveTest)
 	ASSERT (env.nodeEditor.NeedToSave ());
 }
 
+class TestFileIO : public ExternalFileIO
+{
+public:
+	TestFileIO () :
+		readCount (0)
+	{
+
+	}
+
+	virtual bool ReadBufferFromFile (const std::wstring&, std::vector<char>&) const override
+	{
+		readCount++;
+		return false;
+	}
+
+	virtual bool WriteBufferToFile (const std::wstring& fileName, const std::vector<char>& buffer) const override
+	{
+		std::ofstream file (std::string (fileName.begin (), fileName.end ()), std::ios::binary);
+		file.write (buffer.data (), buffer.size ());
+		return file.good ();
+	}
+
+	mutable size_t readCount;
+};
+
+TEST (NodeEditorOpenFileTest)
+{
+	const std::wstring fileName = L"NodeEditorOpenFileTest.ne";
+	TestFileIO fileIO;
+
+	NodeEditorTestEnv env (GetDefaultSkinParams ());
+	env.nodeEditor.AddNode (UINodePtr (new IntegerUpDownNode (L"Integer", Point (0.0, 0.0), 0, 1)));
+	ASSERT (env.nodeEditor.Save (fileName, &fileIO, nullptr));
+
+	env.nodeEditor.New ();
+	ASSERT (env.nodeEditor.Open (fileName, &fileIO, nullptr));
+	ASSERT (fileIO.readCount == 0);
+	ASSERT (!env.nodeEditor.NeedToSave ());
+
+	std::remove (std::string (fileName.begin (), fileName.end ()).c_str ());
+}
+
+static size_t CountUINodes (const NodeUIManager& uiManager)
+{
+	size_t nodeCount = 0;
+	uiManager.EnumerateUINodes ([&] (const UINodeConstPtr&) {
+		nodeCount++;
+		return true;
+	});
+	return nodeCount;
+}
+
+TEST (NodeEditorFixedFormatFileTest)
+{
+	TestDrawingEnvironment drawingEnv;
+	NodeUIManager uiManager (drawingEnv);
+	uiManager.AddNode (UINodePtr (new IntegerUpDownNode (L"Integer", Point (0.0, 0.0), 0, 1)), EmptyEvaluationEnv);
+	uiManager.AddNode (UINodePtr (new DoubleUpDownNode (L"Number", Point (0.0, 0.0), 0.0, 1.0)), EmptyEvaluationEnv);
+
+	MemoryOutputStream fixedOutputStream;
+	fixedOutputStream.Write (std::string ("NodeEditorFile"));
+	EngineVersion.Write (fixedOutputStream);
+	fixedOutputStream.Write (FixedFormatFileVersion);
+	ASSERT (uiManager.Save (fixedOutputStream));
+
+	NodeEditorTestEnv env (GetDefaultSkinParams ());
+	MemoryInputStream fixedInputStream (fixedOutputStream.GetBuffer ());
+	ASSERT (env.nodeEditor.Open (fixedInputStream, nullptr));
+
+	MemoryOutputStream outputStream;
+	ASSERT (env.nodeEditor.Save (outputStream, nullptr));
+	ASSERT (outputStream.GetFormat () == Stream::Format::Fixed);
+	ASSERT (outputStream.GetSize () < fixedOutputStream.GetSize ());
+
+	MemoryInputStream inputStream (outputStream.GetBuffer ());
+	std::string fileMarker;
+	Version fileEngineVersion;
+	int fileVersion = 0;
+	inputStream.Read (fileMarker);
+	fileEngineVersion.Read (inputStream);
+	inputStream.Read (fileVersion);
+	ASSERT (fileMarker == "NodeEditorFile");
+	ASSERT (fileVersion == FileVersion);
+
+	NodeUIManager compactUIManager (drawingEnv);
+	inputStream.SetFormat (Stream::Format::Compact);
+	ASSERT (compactUIManager.Open (drawingEnv, inputStream));
+	ASSERT (CountUINodes (compactUIManager) == 2);
+}
+
 }
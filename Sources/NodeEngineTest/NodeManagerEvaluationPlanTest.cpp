@@ -0,0 +1,166 @@
+#include "SimpleTest.hpp"
+#include "NE_NodeManager.hpp"
+#include "NE_Node.hpp"
+#include "NE_InputSlot.hpp"
+#include "NE_OutputSlot.hpp"
+#include "NE_SingleValues.hpp"
+#include "TestNodes.hpp"
+
+#include <algorithm>
+
+using namespace NE;
+
+namespace NodeManagerEvaluationPlanTest
+{
+
+static int calculationDepth = 0;
+static int maxCalculationDepth = 0;
+
+class TestNode : public SerializableTestNode
+{
+public:
+	TestNode () :
+		SerializableTestNode ()
+	{
+
+	}
+
+	virtual void Initialize () override
+	{
+		RegisterInputSlot (InputSlotPtr (new InputSlot (SlotId ("in"), ValuePtr (new IntValue (0)), OutputSlotConnectionMode::Single)));
+		RegisterOutputSlot (OutputSlotPtr (new OutputSlot (SlotId ("out"))));
+	}
+
+	virtual ValueConstPtr Calculate (NE::EvaluationEnv& env) const override
+	{
+		calculationDepth++;
+		maxCalculationDepth = std::max (maxCalculationDepth, calculationDepth);
+		calculationCounter++;
+		ValueConstPtr in = EvaluateInputSlot (SlotId ("in"), env);
+		calculationDepth--;
+		return ValuePtr (new IntValue (IntValue::Get (in) + 1));
+	}
+
+	mutable int calculationCounter = 0;
+};
+
+static void ConnectNodes (NodeManager& manager, const NodeConstPtr& outputNode, const NodeConstPtr& inputNode)
+{
+	manager.ConnectOutputSlotToInputSlot (outputNode->GetOutputSlot (SlotId ("out")), inputNode->GetInputSlot (SlotId ("in")));
+}
+
+TEST (EvaluationPlanNoRecursionTest)
+{
+	NodeManager manager;
+
+	std::vector<std::shared_ptr<TestNode>> nodes;
+	for (size_t i = 0; i < 10; i++) {
+		std::shared_ptr<TestNode> node (new TestNode ());
+		manager.AddNode (node);
+		nodes.push_back (node);
+	}
+	for (size_t i = nodes.size () - 1; i > 0; i--) {
+		ConnectNodes (manager, nodes[i - 1], nodes[i]);
+	}
+
+	calculationDepth = 0;
+	maxCalculationDepth = 0;
+	manager.EvaluateAllNodes (EmptyEvaluationEnv);
+	ASSERT (maxCalculationDepth == 1);
+	for (size_t i = 0; i < nodes.size (); i++) {
+		ASSERT (nodes[i]->calculationCounter == 1);
+		ASSERT (IntValue::Get (nodes[i]->GetCalculatedValue ()) == (int) i + 1);
+	}
+}
+
+TEST (EvaluationPlanDeepChainTest)
+{
+	const size_t chainLength = 50000;
+
+	NodeManager manager;
+	NodePtr prevNode = nullptr;
+	std::shared_ptr<TestNode> lastNode = nullptr;
+	for (size_t i = 0; i < chainLength; i++) {
+		lastNode.reset (new TestNode ());
+		manager.AddNode (lastNode);
+		if (prevNode != nullptr) {
+			ConnectNodes (manager, prevNode, lastNode);
+		}
+		prevNode = lastNode;
+	}
+
+	manager.EvaluateAllNodes (EmptyEvaluationEnv);
+	ASSERT (IntValue::Get (lastNode->GetCalculatedValue ()) == (int) chainLength);
+}
+
+TEST (EvaluationPlanTopologyChangeTest)
+{
+	NodeManager manager;
+
+	std::shared_ptr<TestNode> node1 (new TestNode ());
+	std::shared_ptr<TestNode> node2 (new TestNode ());
+	manager.AddNode (node1);
+	manager.AddNode (node2);
+
+	manager.EvaluateAllNodes (EmptyEvaluationEnv);
+	ASSERT (IntValue::Get (node1->GetCalculatedValue ()) == 1);
+	ASSERT (IntValue::Get (node2->GetCalculatedValue ()) == 1);
+
+	ConnectNodes (manager, node1, node2);
+	manager.EvaluateAllNodes (EmptyEvaluationEnv);
+	ASSERT (IntValue::Get (node2->GetCalculatedValue ()) == 2);
+
+	std::shared_ptr<TestNode> node3 (new TestNode ());
+	manager.AddNode (node3);
+	ConnectNodes (manager, node3, node1);
+	manager.EvaluateAllNodes (EmptyEvaluationEnv);
+	ASSERT (IntValue::Get (node1->GetCalculatedValue ()) == 2);
+	ASSERT (IntValue::Get (node2->GetCalculatedValue ()) == 3);
+
+	manager.DeleteNode (node1);
+	manager.EvaluateAllNodes (EmptyEvaluationEnv);
+	ASSERT (IntValue::Get (node2->GetCalculatedValue ()) == 1);
+	ASSERT (IntValue::Get (node3->GetCalculatedValue ()) == 1);
+}
+
+TEST (EvaluationPlanInvalidatedNodesTest)
+{
+	NodeManager manager;
+
+	std::vector<std::shared_ptr<TestNode>> chain1;
+	std::vector<std::shared_ptr<TestNode>> chain2;
+	for (size_t i = 0; i < 5; i++) {
+		chain1.push_back (std::shared_ptr<TestNode> (new TestNode ()));
+		chain2.push_back (std::shared_ptr<TestNode> (new TestNode ()));
+		manager.AddNode (chain1.back ());
+		manager.AddNode (chain2.back ());
+		if (i > 0) {
+			ConnectNodes (manager, chain1[i - 1], chain1[i]);
+			ConnectNodes (manager, chain2[i - 1], chain2[i]);
+		}
+	}
+
+	manager.SetUpdateMode (NodeManager::UpdateMode::Manual);
+	manager.EvaluateAllNodes (EmptyEvaluationEnv);
+	for (size_t i = 0; i < 5; i++) {
+		ASSERT (chain1[i]->calculationCounter == 0);
+		ASSERT (chain2[i]->calculationCounter == 0);
+	}
+
+	manager.SetUpdateMode (NodeManager::UpdateMode::Automatic);
+	manager.EvaluateAllNodes (EmptyEvaluationEnv);
+	for (size_t i = 0; i < 5; i++) {
+		ASSERT (chain1[i]->calculationCounter == 1);
+		ASSERT (chain2[i]->calculationCounter == 1);
+	}
+
+	chain1[2]->InvalidateValue ();
+	manager.EvaluateAllNodes (EmptyEvaluationEnv);
+	for (size_t i = 0; i < 5; i++) {
+		ASSERT (chain1[i]->calculationCounter == (i < 2 ? 1 : 2));
+		ASSERT (chain2[i]->calculationCounter == 1);
+	}
+	ASSERT (IntValue::Get (chain1[4]->GetCalculatedValue ()) == 5);
+}
+
+}
@@ -7,6 +7,9 @@
 #include "NE_SingleValues.hpp"
 #include "NE_MemoryStream.hpp"
 
+#include <atomic>
+#include <thread>
+
 using namespace NE;
 
 namespace MergeTest
@@ -77,6 +80,44 @@ private:
 
 DynamicSerializationInfo TestNode::serializationInfo (ObjectId ("{16CF9B46-D77D-4F5E-96EB-494617522929}"), ObjectVersion (1), TestNode::CreateSerializableInstance);
 
+class NonThreadSafeTestNode : public TestNode
+{
+	DYNAMIC_SERIALIZABLE (NonThreadSafeTestNode);
+
+public:
+	NonThreadSafeTestNode () :
+		TestNode ()
+	{
+
+	}
+
+	NonThreadSafeTestNode (const std::wstring& name) :
+		TestNode (name)
+	{
+
+	}
+
+	virtual bool IsThreadSafe () const override
+	{
+		return false;
+	}
+
+	virtual Stream::Status Write (OutputStream& outputStream) const override
+	{
+		if (std::this_thread::get_id () != callingThreadId) {
+			otherThreadWriteCount++;
+		}
+		return TestNode::Write (outputStream);
+	}
+
+	static std::thread::id		callingThreadId;
+	static std::atomic<size_t>	otherThreadWriteCount;
+};
+
+DynamicSerializationInfo NonThreadSafeTestNode::serializationInfo (ObjectId ("{0B6B4F7C-2D6E-4C0F-9B3A-6F1E8A5D2C41}"), ObjectVersion (1), NonThreadSafeTestNode::CreateSerializableInstance);
+std::thread::id NonThreadSafeTestNode::callingThreadId;
+std::atomic<size_t> NonThreadSafeTestNode::otherThreadWriteCount (0);
+
 std::vector<NodeConstPtr> FindNodesByName (const NodeManager& manager, const std::wstring& name)
 {
 	std::vector<NodeConstPtr> result;
@@ -104,6 +145,18 @@ static void InitNodeManager (NodeManager& manager)
 	manager.ConnectOutputSlotToInputSlot (node3->GetOutputSlot (SlotId ("out")), node4->GetInputSlot (SlotId ("a")));
 }
 
+static void InitLargeNodeManager (NodeManager& manager, size_t nodeCount)
+{
+	std::vector<NodePtr> nodes;
+	for (size_t i = 0; i < nodeCount; i++) {
+		NodePtr node = manager.AddNode (NodePtr (new TestNode (std::to_wstring (i))));
+		if (i > 0) {
+			manager.ConnectOutputSlotToInputSlot (nodes[(i - 1) / 2]->GetOutputSlot (SlotId ("out")), node->GetInputSlot (SlotId ("a")));
+		}
+		nodes.push_back (node);
+	}
+}
+
 static bool IsEqualNodeManagers (const NodeManager& source, const NodeManager& target)
 {
 	if (source.GetNodeCount () != target.GetNodeCount ()) {
@@ -376,6 +429,76 @@ TEST (NodeManagerUpdateTest_ModifyNode)
 	ASSERT (Node::Cast<TestNode> (target.GetNode (sourceNode3->GetId ()))->GetName () == L"3");
 }
 
+TEST (MergeManyNodesTest)
+{
+	NodeManager source;
+	InitLargeNodeManager (source, 5000);
+
+	NodeManager target;
+	InitNodeManager (target);
+	AllNodeFilter allNodeFilter;
+	ASSERT (NodeManagerMerge::AppendNodeManager (source, target, allNodeFilter));
+	ASSERT (target.GetNodeCount () == 5004);
+	ASSERT (target.GetConnectionCount () == 5002);
+	ASSERT (FindNodesByName (target, L"0").size () == 1);
+	ASSERT (FindNodesByName (target, L"4999").size () == 1);
+
+	NodeConstPtr targetNode = FindNodesByName (target, L"4999")[0];
+	ValueConstPtr result = targetNode->Evaluate (EmptyEvaluationEnv);
+	ASSERT (IntValue::Get (result) == 14);
+}
+
+TEST (NodeManagerUpdateTest_ManyNodes)
+{
+	NodeManager source;
+	InitLargeNodeManager (source, 5000);
+
+	NodeManager target;
+	NodeManager::Clone (source, target);
+	std::vector<NodeId> nodeIds;
+	target.EnumerateNodes ([&] (const NodeConstPtr& node) {
+		nodeIds.push_back (node->GetId ());
+		return true;
+	});
+	for (size_t i = 0; i < nodeIds.size (); i++) {
+		if (i % 3 == 0) {
+			Node::Cast<TestNode> (target.GetNode (nodeIds[i]))->SetName (L"Modified");
+		} else if (i % 7 == 0) {
+			target.DisconnectAllOutputSlotsFromInputSlot (target.GetNode (nodeIds[i])->GetInputSlot (SlotId ("a")));
+		} else if (i % 11 == 0) {
+			target.DeleteNode (nodeIds[i]);
+		}
+	}
+	ASSERT (!IsEqualNodeManagers (source, target));
+
+	NodeManagerMerge::UpdateNodeManager (source, target, eventHandler);
+	ASSERT (IsEqualNodeManagers (source, target));
+	ASSERT (FindNodesByName (target, L"Modified").empty ());
+}
+
+TEST (MergeNonThreadSafeNodesTest)
+{
+	NodeManager source;
+	InitLargeNodeManager (source, 1000);
+	for (size_t i = 0; i < 1000; i++) {
+		source.AddNode (NodePtr (new NonThreadSafeTestNode (std::to_wstring (i))));
+	}
+
+	NonThreadSafeTestNode::callingThreadId = std::this_thread::get_id ();
+	NonThreadSafeTestNode::otherThreadWriteCount = 0;
+
+	NodeManager appendTarget;
+	AllNodeFilter allNodeFilter;
+	ASSERT (NodeManagerMerge::AppendNodeManager (source, appendTarget, allNodeFilter));
+	ASSERT (appendTarget.GetNodeCount () == 2000);
+
+	NodeManager updateTarget;
+	NodeManager::Clone (source, updateTarget);
+	NodeManagerMerge::UpdateNodeManager (source, updateTarget, eventHandler);
+	ASSERT (IsEqualNodeManagers (source, updateTarget));
+	ASSERT (NonThreadSafeTestNode::otherThreadWriteCount == 0);
+}
+
 TEST (NodeManagerUpdateTest_AddConnection)
 {
 	NodeManager source;
@@ -418,4 +541,28 @@ TEST (NodeManagerUpdateTest_DeleteConnection)
 	ASSERT (IsEqualNodeManagers (source, target));
 }
 
+TEST (NodeContentHashTest)
+{
+	NodeManager manager;
+	NodePtr node = manager.AddNode (NodePtr (new TestNode (L"1")));
+	NodePtr clonedNode = Node::Clone (node);
+	ASSERT (Node::IsEqual (node, clonedNode));
+	ASSERT (node->GetContentHash () == clonedNode->GetContentHash ());
+
+	uint64_t originalHash = node->GetContentHash ();
+	node->SetInputSlotDefaultValue (SlotId ("a"), ValuePtr (new IntValue (2)));
+	ASSERT (node->GetContentHash () != originalHash);
+	ASSERT (!Node::IsEqual (node, clonedNode));
+	node->SetInputSlotDefaultValue (SlotId ("a"), ValuePtr (new IntValue (1)));
+	ASSERT (node->GetContentHash () == originalHash);
+	ASSERT (Node::IsEqual (node, clonedNode));
+
+	Node::Cast<TestNode> (node)->SetName (L"2");
+	node->InvalidateContentHash ();
+	ASSERT (!Node::IsEqual (node, clonedNode));
+	Node::Cast<TestNode> (clonedNode)->SetName (L"2");
+	clonedNode->InvalidateContentHash ();
+	ASSERT (Node::IsEqual (node, clonedNode));
+}
+
 }
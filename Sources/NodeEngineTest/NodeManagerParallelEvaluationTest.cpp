@@ -0,0 +1,271 @@
+#include "SimpleTest.hpp"
+#include "NE_NodeManager.hpp"
+#include "NE_Node.hpp"
+#include "NE_InputSlot.hpp"
+#include "NE_OutputSlot.hpp"
+#include "NE_SingleValues.hpp"
+#include "TestNodes.hpp"
+
+#include <atomic>
+#include <thread>
+#include <stdexcept>
+
+using namespace NE;
+
+namespace NodeManagerParallelEvaluationTest
+{
+
+class InputNode : public SerializableTestNode
+{
+public:
+	InputNode (int val) :
+		SerializableTestNode (),
+		val (val)
+	{
+
+	}
+
+	virtual void Initialize () override
+	{
+		RegisterOutputSlot (OutputSlotPtr (new OutputSlot (SlotId ("out"))));
+	}
+
+	virtual ValueConstPtr Calculate (NE::EvaluationEnv&) const override
+	{
+		return ValuePtr (new IntValue (val));
+	}
+
+private:
+	int val;
+};
+
+class IncreaseNode : public SerializableTestNode
+{
+public:
+	IncreaseNode () :
+		SerializableTestNode (),
+		calculationCounter (0)
+	{
+
+	}
+
+	virtual void Initialize () override
+	{
+		RegisterInputSlot (InputSlotPtr (new InputSlot (SlotId ("in"), ValuePtr (new IntValue (0)), OutputSlotConnectionMode::Single)));
+		RegisterOutputSlot (OutputSlotPtr (new OutputSlot (SlotId ("out"))));
+	}
+
+	virtual ValueConstPtr Calculate (NE::EvaluationEnv& env) const override
+	{
+		calculationCounter++;
+		ValueConstPtr in = EvaluateInputSlot (SlotId ("in"), env);
+		return ValuePtr (new IntValue (IntValue::Get (in) + 1));
+	}
+
+	mutable std::atomic<int> calculationCounter;
+};
+
+class SumNode : public SerializableTestNode
+{
+public:
+	SumNode () :
+		SerializableTestNode ()
+	{
+
+	}
+
+	virtual void Initialize () override
+	{
+		RegisterInputSlot (InputSlotPtr (new InputSlot (SlotId ("in"), ValuePtr (new IntValue (0)), OutputSlotConnectionMode::Multiple)));
+		RegisterOutputSlot (OutputSlotPtr (new OutputSlot (SlotId ("out"))));
+	}
+
+	virtual ValueConstPtr Calculate (NE::EvaluationEnv& env) const override
+	{
+		ValueConstPtr in = EvaluateInputSlot (SlotId ("in"), env);
+		if (!Value::IsType<ListValue> (in)) {
+			return ValuePtr (new IntValue (IntValue::Get (in)));
+		}
+		int sum = 0;
+		Value::Cast<ListValue> (in)->Enumerate ([&] (const ValueConstPtr& val) {
+			sum += IntValue::Get (val);
+		});
+		return ValuePtr (new IntValue (sum));
+	}
+};
+
+class NotThreadSafeNode : public IncreaseNode
+{
+public:
+	NotThreadSafeNode () :
+		IncreaseNode (),
+		calculationThreadId ()
+	{
+
+	}
+
+	virtual ValueConstPtr Calculate (NE::EvaluationEnv& env) const override
+	{
+		calculationThreadId = std::this_thread::get_id ();
+		return IncreaseNode::Calculate (env);
+	}
+
+	virtual bool IsThreadSafe () const override
+	{
+		return false;
+	}
+
+	mutable std::thread::id calculationThreadId;
+};
+
+class ThrowingNode : public IncreaseNode
+{
+public:
+	ThrowingNode () :
+		IncreaseNode ()
+	{
+
+	}
+
+	virtual ValueConstPtr Calculate (NE::EvaluationEnv& env) const override
+	{
+		IncreaseNode::Calculate (env);
+		throw std::runtime_error ("calculation failed");
+	}
+};
+
+static void ConnectNodes (NodeManager& manager, const NodeConstPtr& outputNode, const NodeConstPtr& inputNode)
+{
+	manager.ConnectOutputSlotToInputSlot (outputNode->GetOutputSlot (SlotId ("out")), inputNode->GetInputSlot (SlotId ("in")));
+}
+
+class BranchingGraph
+{
+public:
+	BranchingGraph (NodeManager& manager, size_t branchCount, size_t branchLength) :
+		inputNode (new InputNode (1)),
+		sumNode (new SumNode ())
+	{
+		manager.AddNode (inputNode);
+		manager.AddNode (sumNode);
+		for (size_t i = 0; i < branchCount; i++) {
+			NodePtr prevNode = inputNode;
+			for (size_t j = 0; j < branchLength; j++) {
+				std::shared_ptr<IncreaseNode> increaseNode (new IncreaseNode ());
+				manager.AddNode (increaseNode);
+				ConnectNodes (manager, prevNode, increaseNode);
+				increaseNodes.push_back (increaseNode);
+				prevNode = increaseNode;
+			}
+			ConnectNodes (manager, prevNode, sumNode);
+		}
+	}
+
+	std::shared_ptr<InputNode>					inputNode;
+	std::shared_ptr<SumNode>					sumNode;
+	std::vector<std::shared_ptr<IncreaseNode>>	increaseNodes;
+};
+
+TEST (ParallelEvaluationModeTest)
+{
+	NodeManager manager;
+	ASSERT (manager.GetEvaluationMode () == NodeManager::EvaluationMode::Serial);
+	manager.SetEvaluationMode (NodeManager::EvaluationMode::Parallel);
+	ASSERT (manager.GetEvaluationMode () == NodeManager::EvaluationMode::Parallel);
+	manager.EvaluateAllNodes (EmptyEvaluationEnv);
+}
+
+TEST (ParallelEvaluationBranchingGraphTest)
+{
+	const size_t branchCount = 100;
+	const size_t branchLength = 20;
+
+	NodeManager manager;
+	manager.SetEvaluationMode (NodeManager::EvaluationMode::Parallel);
+	BranchingGraph graph (manager, branchCount, branchLength);
+
+	manager.EvaluateAllNodes (EmptyEvaluationEnv);
+	for (const std::shared_ptr<IncreaseNode>& node : graph.increaseNodes) {
+		ASSERT (node->calculationCounter == 1);
+		ASSERT (node->HasCalculatedValue ());
+	}
+	ASSERT (graph.sumNode->HasCalculatedValue ());
+	ASSERT (IntValue::Get (graph.sumNode->GetCalculatedValue ()) == (int) (branchCount * (branchLength + 1)));
+
+	graph.inputNode->InvalidateValue ();
+	manager.EvaluateAllNodes (EmptyEvaluationEnv);
+	for (const std::shared_ptr<IncreaseNode>& node : graph.increaseNodes) {
+		ASSERT (node->calculationCounter == 2);
+	}
+	ASSERT (IntValue::Get (graph.sumNode->GetCalculatedValue ()) == (int) (branchCount * (branchLength + 1)));
+}
+
+TEST (ParallelEvaluationSameResultAsSerialTest)
+{
+	NodeManager serialManager;
+	BranchingGraph serialGraph (serialManager, 10, 10);
+	serialManager.EvaluateAllNodes (EmptyEvaluationEnv);
+
+	NodeManager parallelManager;
+	parallelManager.SetEvaluationMode (NodeManager::EvaluationMode::Parallel);
+	BranchingGraph parallelGraph (parallelManager, 10, 10);
+	parallelManager.EvaluateAllNodes (EmptyEvaluationEnv);
+
+	ASSERT (serialGraph.increaseNodes.size () == parallelGraph.increaseNodes.size ());
+	for (size_t i = 0; i < serialGraph.increaseNodes.size (); i++) {
+		int serialResult = IntValue::Get (serialGraph.increaseNodes[i]->GetCalculatedValue ());
+		int parallelResult = IntValue::Get (parallelGraph.increaseNodes[i]->GetCalculatedValue ());
+		ASSERT (serialResult == parallelResult);
+	}
+	int serialSum = IntValue::Get (serialGraph.sumNode->GetCalculatedValue ());
+	int parallelSum = IntValue::Get (parallelGraph.sumNode->GetCalculatedValue ());
+	ASSERT (serialSum == parallelSum);
+}
+
+TEST (ParallelEvaluationNotThreadSafeNodeTest)
+{
+	NodeManager manager;
+	manager.SetEvaluationMode (NodeManager::EvaluationMode::Parallel);
+	BranchingGraph graph (manager, 10, 5);
+
+	std::shared_ptr<NotThreadSafeNode> notThreadSafeNode (new NotThreadSafeNode ());
+	std::shared_ptr<IncreaseNode> afterNode (new IncreaseNode ());
+	manager.AddNode (notThreadSafeNode);
+	manager.AddNode (afterNode);
+	ConnectNodes (manager, graph.increaseNodes.back (), notThreadSafeNode);
+	ConnectNodes (manager, notThreadSafeNode, afterNode);
+
+	manager.EvaluateAllNodes (EmptyEvaluationEnv);
+	ASSERT (notThreadSafeNode->calculationCounter == 1);
+	ASSERT (notThreadSafeNode->calculationThreadId == std::this_thread::get_id ());
+	ASSERT (IntValue::Get (notThreadSafeNode->GetCalculatedValue ()) == 7);
+	ASSERT (IntValue::Get (afterNode->GetCalculatedValue ()) == 8);
+}
+
+
+TEST (ParallelEvaluationExceptionTest)
+{
+	NodeManager manager;
+	manager.SetEvaluationMode (NodeManager::EvaluationMode::Parallel);
+	BranchingGraph graph (manager, 10, 5);
+
+	std::shared_ptr<ThrowingNode> throwingNode (new ThrowingNode ());
+	std::shared_ptr<IncreaseNode> afterNode (new IncreaseNode ());
+	manager.AddNode (throwingNode);
+	manager.AddNode (afterNode);
+	ConnectNodes (manager, graph.increaseNodes.back (), throwingNode);
+	ConnectNodes (manager, throwingNode, afterNode);
+
+	bool isThrown = false;
+	try {
+		manager.EvaluateAllNodes (EmptyEvaluationEnv);
+	} catch (const std::runtime_error&) {
+		isThrown = true;
+	}
+	ASSERT (isThrown);
+	ASSERT (throwingNode->calculationCounter == 1);
+	ASSERT (afterNode->calculationCounter == 0);
+	ASSERT (!throwingNode->HasCalculatedValue ());
+}
+
+}
@@ -6,6 +6,8 @@
 #include "NE_SingleValues.hpp"
 #include "TestNodes.hpp"
 
+#include <algorithm>
+
 using namespace NE;
 
 namespace NodeRecalculationTest
@@ -36,6 +38,35 @@ public:
 	mutable int calculationCounter = 0;
 };
 
+class MaxNode : public SerializableTestNode
+{
+public:
+	MaxNode () :
+		SerializableTestNode ()
+	{
+	
+	}
+
+	virtual void Initialize () override
+	{
+		RegisterInputSlot (InputSlotPtr (new InputSlot (SlotId ("in"), ValuePtr (new IntValue (0)), OutputSlotConnectionMode::Multiple)));
+		RegisterOutputSlot (OutputSlotPtr (new OutputSlot (SlotId ("out"))));
+	}
+
+	virtual ValueConstPtr Calculate (NE::EvaluationEnv& env) const override
+	{
+		calculationCounter++;
+		ValueConstPtr in = EvaluateInputSlot (SlotId ("in"), env);
+		int maxValue = 0;
+		FlatEnumerate (in, [&] (const ValueConstPtr& value) {
+			maxValue = std::max (maxValue, IntValue::Get (value));
+		});
+		return ValuePtr (new IntValue (maxValue + 1));
+	}
+
+	mutable int calculationCounter = 0;
+};
+
 TEST (RecalculationTest)
 {
 	NodeManager manager;
@@ -120,4 +151,50 @@ TEST (RecalculationTest)
 	}
 }
 
+TEST (LatticeRecalculationTest)
+{
+	const size_t layerCount = 100;
+	const size_t layerWidth = 3;
+
+	NodeManager manager;
+	std::vector<std::vector<std::shared_ptr<MaxNode>>> layers;
+	for (size_t i = 0; i < layerCount; ++i) {
+		layers.push_back (std::vector<std::shared_ptr<MaxNode>> ());
+		for (size_t j = 0; j < layerWidth; ++j) {
+			std::shared_ptr<MaxNode> node (new MaxNode ());
+			manager.AddNode (node);
+			if (i > 0) {
+				for (const std::shared_ptr<MaxNode>& prevNode : layers[i - 1]) {
+					manager.ConnectOutputSlotToInputSlot (prevNode->GetOutputSlot (SlotId ("out")), node->GetInputSlot (SlotId ("in")));
+				}
+			}
+			layers[i].push_back (node);
+		}
+	}
+
+	manager.EvaluateAllNodes (EmptyEvaluationEnv);
+	for (size_t i = 0; i < layerCount; ++i) {
+		for (const std::shared_ptr<MaxNode>& node : layers[i]) {
+			ASSERT (node->calculationCounter == 1);
+			ASSERT (IntValue::Get (node->GetCalculatedValue ()) == (int) i + 1);
+		}
+	}
+
+	layers[0][0]->InvalidateValue ();
+	for (size_t i = 0; i < layerCount; ++i) {
+		for (size_t j = 0; j < layerWidth; ++j) {
+			bool isInvalidated = (i > 0 || j == 0);
+			ASSERT (layers[i][j]->HasCalculatedValue () == !isInvalidated);
+		}
+	}
+
+	manager.EvaluateAllNodes (EmptyEvaluationEnv);
+	for (size_t i = 0; i < layerCount; ++i) {
+		for (size_t j = 0; j < layerWidth; ++j) {
+			bool isInvalidated = (i > 0 || j == 0);
+			ASSERT (layers[i][j]->calculationCounter == (isInvalidated ? 2 : 1));
+		}
+	}
+}
+
 }
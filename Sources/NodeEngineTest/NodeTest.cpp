@@ -143,4 +143,19 @@ TEST (NodeSlotEnumerationTest)
 	}
 }
 
+TEST (NodeSlotEnumerationReferenceTest)
+{
+	NodeManager manager;
+
+	NodePtr node (new TestNode ());
+	manager.AddNode (node);
+
+	NodeConstPtr constNode = node;
+	long useCount = constNode->GetInputSlot (SlotId ("a")).use_count ();
+	constNode->EnumerateInputSlots ([&] (const InputSlotConstPtr& inputSlot) {
+		ASSERT (inputSlot.use_count () == useCount - 1);
+		return true;
+	});
+}
+
 }
@@ -1,7 +1,9 @@
 #include "SimpleTest.hpp"
 #include "NE_Serializable.hpp"
 #include "NE_SingleValues.hpp"
+#include "NE_NumberListValues.hpp"
 #include "NE_MemoryStream.hpp"
+#include "NE_SlotId.hpp"
 
 #include <memory>
 
@@ -285,4 +287,103 @@ TEST (ValueTest)
 	ASSERT (DoubleValue::Get (doubleVal) == DoubleValue::Get (newListVal->GetValue (1)));
 }
 
+TEST (SlotIdTest)
+{
+	SlotId slotId ("alma");
+	ASSERT (slotId == SlotId ("alma"));
+	ASSERT (slotId != SlotId ("korte"));
+	ASSERT (slotId != SlotId ());
+	ASSERT (slotId < SlotId ("korte"));
+	ASSERT (SlotId ("korte") > slotId);
+	ASSERT (!(slotId < SlotId ("alma")));
+	ASSERT (slotId.GenerateHashValue () == std::hash<std::string> {} ("alma"));
+
+	MemoryOutputStream outputStream;
+	slotId.Write (outputStream);
+
+	MemoryInputStream stringInputStream (outputStream.GetBuffer ());
+	ObjectHeader header (stringInputStream);
+	std::string slotIdString;
+	stringInputStream.Read (slotIdString);
+	ASSERT (header.GetVersion () == ObjectVersion (1));
+	ASSERT (slotIdString == "alma");
+
+	SlotId newSlotId;
+	MemoryInputStream inputStream (outputStream.GetBuffer ());
+	newSlotId.Read (inputStream);
+	ASSERT (inputStream.GetStatus () == Stream::Status::NoError);
+	ASSERT (newSlotId == slotId);
+}
+
+TEST (CompactListValueTest)
+{
+	ListValuePtr listVal (new ListValue ());
+	DoubleListValuePtr doubleListVal (new DoubleListValue ());
+	for (size_t i = 0; i < 1000; i++) {
+		listVal->Push (ValuePtr (new DoubleValue ((double) i)));
+		doubleListVal->PushItem ((double) i);
+	}
+
+	MemoryOutputStream fixedOutputStream;
+	WriteDynamicObject (fixedOutputStream, listVal.get ());
+
+	MemoryOutputStream compactOutputStream;
+	compactOutputStream.SetFormat (Stream::Format::Compact);
+	WriteDynamicObject (compactOutputStream, listVal.get ());
+	WriteDynamicObject (compactOutputStream, doubleListVal.get ());
+	ASSERT (compactOutputStream.GetSize () * 2 < fixedOutputStream.GetSize ());
+
+	MemoryInputStream compactInputStream (compactOutputStream.GetBuffer ());
+	compactInputStream.SetFormat (Stream::Format::Compact);
+	ValuePtr newListVal (ReadDynamicObject<Value> (compactInputStream));
+	ValuePtr newDoubleListVal (ReadDynamicObject<Value> (compactInputStream));
+	ASSERT (compactInputStream.GetStatus () == Stream::Status::NoError);
+
+	ASSERT (Value::IsType<ListValue> (newListVal));
+	ASSERT (Value::Cast<ListValue> (newListVal)->GetSize () == 1000);
+	ASSERT (DoubleValue::Get (Value::Cast<ListValue> (newListVal)->GetValue (999)) == 999.0);
+
+	ASSERT (Value::IsType<DoubleListValue> (newDoubleListVal));
+	ASSERT (Value::Cast<DoubleListValue> (newDoubleListVal)->GetItems () == doubleListVal->GetItems ());
+}
+
+TEST (ObjectIdTest)
+{
+	ObjectId objectId ("{0F4E6A8B-5C3D-4B2A-9E1F-7A6B5C4D3E2F}");
+	ObjectId sameObjectId ("{0F4E6A8B-5C3D-4B2A-9E1F-7A6B5C4D3E2F}");
+	ObjectId otherObjectId ("{3B9D2C71-8E4F-4A6D-B5C2-1F0E9D8C7B6A}");
+	ASSERT (objectId == sameObjectId);
+	ASSERT (objectId != otherObjectId);
+	ASSERT (objectId.GenerateHashValue () == sameObjectId.GenerateHashValue ());
+
+	MemoryOutputStream outputStream;
+	outputStream.SetFormat (Stream::Format::Compact);
+	objectId.Write (outputStream);
+
+	ObjectId readObjectId;
+	MemoryInputStream inputStream (outputStream.GetBuffer ());
+	inputStream.SetFormat (Stream::Format::Compact);
+	ASSERT (readObjectId.Read (inputStream) == Stream::Status::NoError);
+	ASSERT (readObjectId == objectId);
+	ASSERT (readObjectId.GenerateHashValue () == objectId.GenerateHashValue ());
+}
+
+TEST (ResolveIdentifierOnceTest)
+{
+	ListValuePtr listVal (new ListValue ());
+	listVal->Push (ValuePtr (new IntValue (1)));
+	listVal->Push (ValuePtr (new IntValue (2)));
+
+	MemoryOutputStream outputStream;
+	outputStream.SetFormat (Stream::Format::Compact);
+	WriteDynamicObject (outputStream, listVal.get ());
+
+	MemoryInputStream inputStream (outputStream.GetBuffer ());
+	inputStream.SetFormat (Stream::Format::Compact);
+	ValuePtr newListVal (ReadDynamicObject<Value> (inputStream));
+	ASSERT (newListVal != nullptr);
+	ASSERT (inputStream.GetIdentifierData (0) == listVal->GetDynamicSerializationInfo ());
+	ASSERT (inputStream.GetIdentifierData (1) == listVal->GetValue (0)->GetDynamicSerializationInfo ());
+}
+
 }
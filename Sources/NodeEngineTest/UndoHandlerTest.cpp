@@ -0,0 +1,272 @@
+#include "SimpleTest.hpp"
+#include "NUIE_NodeUIManager.hpp"
+#include "NUIE_NodeUIManagerCommands.hpp"
+#include "BI_InputUINodes.hpp"
+#include "BI_ArithmeticUINodes.hpp"
+#include "TestUtils.hpp"
+
+using namespace NE;
+using namespace NUIE;
+using namespace BI;
+
+namespace UndoHandlerTest
+{
+
+class UndoTestEnv
+{
+public:
+	UndoTestEnv () :
+		drawingEnv (),
+		uiManager (drawingEnv),
+		inputNode (),
+		additionNode (),
+		otherNode ()
+	{
+		inputNode = uiManager.AddNode (UINodePtr (new IntegerUpDownNode (L"Integer", Point (0.0, 0.0), 1, 1)), EmptyEvaluationEnv)->GetId ();
+		additionNode = uiManager.AddNode (UINodePtr (new AdditionNode (L"Addition", Point (100.0, 0.0))), EmptyEvaluationEnv)->GetId ();
+		otherNode = uiManager.AddNode (UINodePtr (new IntegerUpDownNode (L"Other", Point (0.0, 100.0), 2, 1)), EmptyEvaluationEnv)->GetId ();
+		uiManager.ConnectOutputSlotToInputSlot (GetNode (inputNode)->GetUIOutputSlot (SlotId ("out")), GetNode (additionNode)->GetUIInputSlot (SlotId ("a")));
+	}
+
+	UINodeConstPtr GetNode (const NodeId& nodeId) const
+	{
+		return uiManager.GetUINode (nodeId);
+	}
+
+	bool IsConnected (const NodeId& outputNodeId, const NodeId& inputNodeId, const SlotId& inputSlotId) const
+	{
+		UINodeConstPtr outputNode = GetNode (outputNodeId);
+		UINodeConstPtr inputNode = GetNode (inputNodeId);
+		return uiManager.IsOutputSlotConnectedToInputSlot (outputNode->GetUIOutputSlot (SlotId ("out")), inputNode->GetUIInputSlot (inputSlotId));
+	}
+
+	size_t GetNodeCount () const
+	{
+		size_t nodeCount = 0;
+		uiManager.EnumerateUINodes ([&] (const UINodeConstPtr&) {
+			nodeCount++;
+			return true;
+		});
+		return nodeCount;
+	}
+
+	TestDrawingEnvironment	drawingEnv;
+	NodeUIManager			uiManager;
+	NodeId					inputNode;
+	NodeId					additionNode;
+	NodeId					otherNode;
+};
+
+TEST (MoveNodesUndoTest)
+{
+	UndoTestEnv env;
+	NodeCollection nodes ({ env.inputNode });
+	std::vector<Point> offsets ({ Point (10.0, 20.0) });
+	MoveNodesCommand command (nodes, offsets);
+	env.uiManager.ExecuteCommand (command);
+	ASSERT (IsEqual (env.GetNode (env.inputNode)->GetNodePosition (), Point (10.0, 20.0)));
+
+	UINodeConstPtr otherNodeBeforeUndo = env.GetNode (env.otherNode);
+	ASSERT (env.uiManager.Undo (EmptyEvaluationEnv));
+	ASSERT (IsEqual (env.GetNode (env.inputNode)->GetNodePosition (), Point (0.0, 0.0)));
+	ASSERT (env.IsConnected (env.inputNode, env.additionNode, SlotId ("a")));
+	ASSERT (env.GetNode (env.otherNode) == otherNodeBeforeUndo);
+
+	ASSERT (env.uiManager.Redo (EmptyEvaluationEnv));
+	ASSERT (IsEqual (env.GetNode (env.inputNode)->GetNodePosition (), Point (10.0, 20.0)));
+	ASSERT (env.IsConnected (env.inputNode, env.additionNode, SlotId ("a")));
+	ASSERT (env.GetNode (env.otherNode) == otherNodeBeforeUndo);
+}
+
+TEST (ConnectSlotsUndoTest)
+{
+	UndoTestEnv env;
+	UIOutputSlotConstPtr outputSlot = env.GetNode (env.inputNode)->GetUIOutputSlot (SlotId ("out"));
+	UIInputSlotConstPtr oldInputSlot = env.GetNode (env.additionNode)->GetUIInputSlot (SlotId ("a"));
+	UIInputSlotConstPtr newInputSlot = env.GetNode (env.additionNode)->GetUIInputSlot (SlotId ("b"));
+	ReconnectSlotsCommand command (outputSlot, oldInputSlot, newInputSlot);
+	env.uiManager.ExecuteCommand (command);
+	ASSERT (!env.IsConnected (env.inputNode, env.additionNode, SlotId ("a")));
+	ASSERT (env.IsConnected (env.inputNode, env.additionNode, SlotId ("b")));
+
+	ASSERT (env.uiManager.Undo (EmptyEvaluationEnv));
+	ASSERT (env.IsConnected (env.inputNode, env.additionNode, SlotId ("a")));
+	ASSERT (!env.IsConnected (env.inputNode, env.additionNode, SlotId ("b")));
+
+	ASSERT (env.uiManager.Redo (EmptyEvaluationEnv));
+	ASSERT (!env.IsConnected (env.inputNode, env.additionNode, SlotId ("a")));
+	ASSERT (env.IsConnected (env.inputNode, env.additionNode, SlotId ("b")));
+
+	UIOutputSlotConstPtr otherOutputSlot = env.GetNode (env.otherNode)->GetUIOutputSlot (SlotId ("out"));
+	UIInputSlotConstPtr inputSlot = env.GetNode (env.additionNode)->GetUIInputSlot (SlotId ("a"));
+	ConnectSlotsCommand connectCommand (otherOutputSlot, inputSlot);
+	env.uiManager.ExecuteCommand (connectCommand);
+	ASSERT (env.IsConnected (env.otherNode, env.additionNode, SlotId ("a")));
+	ASSERT (env.uiManager.Undo (EmptyEvaluationEnv));
+	ASSERT (!env.IsConnected (env.otherNode, env.additionNode, SlotId ("a")));
+	ASSERT (env.IsConnected (env.inputNode, env.additionNode, SlotId ("b")));
+}
+
+TEST (DeleteGroupedNodesUndoTest)
+{
+	UndoTestEnv env;
+	UINodeGroupPtr group (new UINodeGroup (L"Group"));
+	NodeCollection groupNodes ({ env.inputNode, env.otherNode });
+	AddGroupCommand addGroupCommand (group, groupNodes);
+	env.uiManager.ExecuteCommand (addGroupCommand);
+	ASSERT (env.uiManager.GetUINodeGroup (env.inputNode) != nullptr);
+
+	NodeCollection deletedNodes ({ env.inputNode });
+	DeleteNodesCommand deleteCommand (deletedNodes, EmptyEvaluationEnv);
+	env.uiManager.ExecuteCommand (deleteCommand);
+	ASSERT (env.GetNodeCount () == 2);
+	ASSERT (!env.uiManager.ContainsUINode (env.inputNode));
+
+	ASSERT (env.uiManager.Undo (EmptyEvaluationEnv));
+	ASSERT (env.GetNodeCount () == 3);
+	ASSERT (env.IsConnected (env.inputNode, env.additionNode, SlotId ("a")));
+	UINodeGroupConstPtr restoredGroup = env.uiManager.GetUINodeGroup (env.inputNode);
+	ASSERT (restoredGroup != nullptr);
+	ASSERT (env.uiManager.GetUINodeGroup (env.otherNode) == restoredGroup);
+
+	ASSERT (env.uiManager.Undo (EmptyEvaluationEnv));
+	ASSERT (env.uiManager.GetUINodeGroup (env.inputNode) == nullptr);
+	ASSERT (env.uiManager.GetUINodeGroup (env.otherNode) == nullptr);
+
+	ASSERT (env.uiManager.Redo (EmptyEvaluationEnv));
+	ASSERT (env.uiManager.Redo (EmptyEvaluationEnv));
+	ASSERT (env.GetNodeCount () == 2);
+	ASSERT (env.uiManager.GetUINodeGroup (env.otherNode) != nullptr);
+}
+
+TEST (AddNodeUndoTest)
+{
+	UndoTestEnv env;
+	UINodePtr newNode (new IntegerUpDownNode (L"New", Point (0.0, 200.0), 3, 1));
+	AddNodeCommand addCommand (newNode, EmptyEvaluationEnv);
+	env.uiManager.ExecuteCommand (addCommand);
+	NodeId newNodeId = newNode->GetId ();
+	ASSERT (env.GetNodeCount () == 4);
+
+	ASSERT (env.uiManager.Undo (EmptyEvaluationEnv));
+	ASSERT (env.GetNodeCount () == 3);
+	ASSERT (!env.uiManager.ContainsUINode (newNodeId));
+
+	ASSERT (env.uiManager.Redo (EmptyEvaluationEnv));
+	ASSERT (env.GetNodeCount () == 4);
+	ASSERT (env.uiManager.ContainsUINode (newNodeId));
+	ASSERT (env.GetNode (newNodeId)->GetNodeName () == L"New");
+
+	ASSERT (env.uiManager.Copy (NodeCollection ({ env.inputNode, env.additionNode })));
+	PasteNodesCommand pasteCommand (Point (300.0, 300.0));
+	env.uiManager.ExecuteCommand (pasteCommand);
+	ASSERT (env.GetNodeCount () == 6);
+
+	ASSERT (env.uiManager.Undo (EmptyEvaluationEnv));
+	ASSERT (env.GetNodeCount () == 4);
+	ASSERT (env.uiManager.Redo (EmptyEvaluationEnv));
+	ASSERT (env.GetNodeCount () == 6);
+}
+
+TEST (SaveUndoStateTest)
+{
+	UndoTestEnv env;
+	env.uiManager.SaveUndoState ();
+	NodeId newNodeId = env.uiManager.AddNode (UINodePtr (new IntegerUpDownNode (L"New", Point (0.0, 200.0), 3, 1)), EmptyEvaluationEnv)->GetId ();
+	env.uiManager.DeleteNode (env.inputNode, EmptyEvaluationEnv);
+	ASSERT (env.GetNodeCount () == 3);
+
+	ASSERT (env.uiManager.Undo (EmptyEvaluationEnv));
+	ASSERT (env.GetNodeCount () == 3);
+	ASSERT (!env.uiManager.ContainsUINode (newNodeId));
+	ASSERT (env.IsConnected (env.inputNode, env.additionNode, SlotId ("a")));
+
+	ASSERT (env.uiManager.Redo (EmptyEvaluationEnv));
+	ASSERT (env.uiManager.ContainsUINode (newNodeId));
+	ASSERT (!env.uiManager.ContainsUINode (env.inputNode));
+}
+
+TEST (UndoMemoryLimitTest)
+{
+	UndoTestEnv env;
+	NodeCollection nodes ({ env.inputNode });
+	std::vector<Point> offsets ({ Point (1.0, 0.0) });
+	for (size_t i = 0; i < 100; i++) {
+		MoveNodesCommand command (nodes, offsets);
+		env.uiManager.ExecuteCommand (command);
+	}
+	size_t unlimitedMemoryUsage = env.uiManager.GetUndoMemoryUsage ();
+	ASSERT (unlimitedMemoryUsage > 0);
+
+	env.uiManager.SetUndoMemoryLimit (unlimitedMemoryUsage / 10);
+	ASSERT (env.uiManager.GetUndoMemoryUsage () <= unlimitedMemoryUsage / 10);
+
+	size_t undoCount = 0;
+	while (env.uiManager.Undo (EmptyEvaluationEnv)) {
+		undoCount++;
+	}
+	ASSERT (undoCount > 0 && undoCount <= 10);
+	ASSERT (IsEqual (env.GetNode (env.inputNode)->GetNodePosition (), Point ((double) (100 - undoCount), 0.0)));
+	ASSERT (env.IsConnected (env.inputNode, env.additionNode, SlotId ("a")));
+
+	env.uiManager.SetUndoMemoryLimit (0);
+	ASSERT (env.uiManager.Redo (EmptyEvaluationEnv));
+	ASSERT (IsEqual (env.GetNode (env.inputNode)->GetNodePosition (), Point ((double) (101 - undoCount), 0.0)));
+}
+
+TEST (UndoMemoryLimitWithRedoTest)
+{
+	UndoTestEnv env;
+	NodeCollection nodes ({ env.inputNode });
+	std::vector<Point> offsets ({ Point (1.0, 0.0) });
+	for (size_t i = 0; i < 20; i++) {
+		MoveNodesCommand command (nodes, offsets);
+		env.uiManager.ExecuteCommand (command);
+	}
+	for (size_t i = 0; i < 5; i++) {
+		ASSERT (env.uiManager.Undo (EmptyEvaluationEnv));
+	}
+
+	size_t memoryUsage = env.uiManager.GetUndoMemoryUsage ();
+	env.uiManager.SetUndoMemoryLimit (memoryUsage / 2);
+	ASSERT (env.uiManager.GetUndoMemoryUsage () <= memoryUsage / 2);
+	for (size_t i = 0; i < 5; i++) {
+		ASSERT (env.uiManager.Redo (EmptyEvaluationEnv));
+	}
+	ASSERT (!env.uiManager.Redo (EmptyEvaluationEnv));
+	ASSERT (IsEqual (env.GetNode (env.inputNode)->GetNodePosition (), Point (20.0, 0.0)));
+
+	for (size_t i = 0; i < 5; i++) {
+		ASSERT (env.uiManager.Undo (EmptyEvaluationEnv));
+	}
+	env.uiManager.SetUndoMemoryLimit (0);
+	ASSERT (env.uiManager.GetUndoMemoryUsage () > 0);
+	ASSERT (!env.uiManager.Undo (EmptyEvaluationEnv));
+	ASSERT (env.uiManager.Redo (EmptyEvaluationEnv));
+	ASSERT (!env.uiManager.Redo (EmptyEvaluationEnv));
+	ASSERT (IsEqual (env.GetNode (env.inputNode)->GetNodePosition (), Point (16.0, 0.0)));
+}
+
+TEST (CompressedUndoStateTest)
+{
+	UndoHandler compressedHandler;
+	UndoHandler rawHandler;
+	rawHandler.SetCompression (CompressionMode::None);
+
+	NodeManager nodeManager;
+	NodeCollection nodes;
+	for (int i = 0; i < 100; i++) {
+		NodePtr node = nodeManager.AddNode (NodePtr (new IntegerUpDownNode (L"Integer", Point (0.0, 0.0), i, 1)));
+		nodes.Insert (node->GetId ());
+	}
+
+	compressedHandler.SaveUndoState (nodeManager, UndoScope (nodes, false));
+	compressedHandler.FinishUndoState (nodeManager);
+	rawHandler.SaveUndoState (nodeManager, UndoScope (nodes, false));
+	rawHandler.FinishUndoState (nodeManager);
+	ASSERT (compressedHandler.GetUndoStepCount () == 1);
+	ASSERT (rawHandler.GetUndoStepCount () == 1);
+	ASSERT (compressedHandler.GetMemoryUsage () * 2 < rawHandler.GetMemoryUsage ());
+}
+
+}
@@ -0,0 +1,137 @@
+#include "SimpleTest.hpp"
+#include "NE_ValueAllocator.hpp"
+#include "NE_SingleValues.hpp"
+#include "NE_NumberListValues.hpp"
+#include "AllocationCounter.hpp"
+
+#include <cmath>
+#include <thread>
+
+using namespace NE;
+
+namespace ValueAllocatorTest
+{
+
+TEST (CanonicalValuesTest)
+{
+	ASSERT (BooleanValue::Create (true) == BooleanValue::Create (true));
+	ASSERT (BooleanValue::Create (false) == BooleanValue::Create (false));
+	ASSERT (BooleanValue::Get (BooleanValue::Create (true)) == true);
+	ASSERT (BooleanValue::Get (BooleanValue::Create (false)) == false);
+
+	ASSERT (IntValue::Create (0) == IntValue::Create (0));
+	ASSERT (IntValue::Create (1) == IntValue::Create (1));
+	ASSERT (IntValue::Create (2) != IntValue::Create (2));
+	ASSERT (IntValue::Get (IntValue::Create (2)) == 2);
+
+	ASSERT (DoubleValue::Create (0.0) == DoubleValue::Create (0.0));
+	ASSERT (DoubleValue::Create (1.0) == DoubleValue::Create (1.0));
+	ASSERT (DoubleValue::Create (-0.0) != DoubleValue::Create (0.0));
+	ASSERT (std::signbit (DoubleValue::Get (DoubleValue::Create (-0.0))));
+	ASSERT (DoubleValue::Get (DoubleValue::Create (2.5)) == 2.5);
+}
+
+TEST (PooledValuesTest)
+{
+	ValuePtr intValue = CreateValue<IntValue> (5);
+	ValuePtr stringValue = CreateValue<StringValue> (L"pooled");
+	ValuePtr clonedValue = intValue->Clone ();
+	ASSERT (Value::IsType<IntValue> (intValue));
+	ASSERT (IntValue::Get (intValue) == 5);
+	ASSERT (StringValue::Get (stringValue) == L"pooled");
+	ASSERT (clonedValue != intValue);
+	ASSERT (IntValue::Get (clonedValue) == 5);
+
+	std::shared_ptr<DoubleListValue> listValue = CreateValue<DoubleListValue> (std::vector<double> ({ 1.0, 2.0 }));
+	ASSERT (listValue->GetSize () == 2);
+	ASSERT (DoubleValue::Get (listValue->GetValue (1)) == 2.0);
+}
+
+TEST (PooledValueAllocationTest)
+{
+	const size_t valueCount = 10000;
+	std::vector<ValueConstPtr> values;
+	values.reserve (valueCount);
+
+	size_t allocationsBefore = GetAllocationCount ();
+	for (size_t i = 0; i < valueCount; i++) {
+		values.push_back (ValuePtr (new DoubleValue ((double) i + 2.0)));
+	}
+	size_t plainAllocations = GetAllocationCount () - allocationsBefore;
+	values.clear ();
+
+	allocationsBefore = GetAllocationCount ();
+	for (size_t i = 0; i < valueCount; i++) {
+		values.push_back (DoubleValue::Create ((double) i + 2.0));
+	}
+	size_t pooledAllocations = GetAllocationCount () - allocationsBefore;
+	ASSERT (DoubleValue::Get (values.back ()) == (double) valueCount + 1.0);
+	values.clear ();
+
+	allocationsBefore = GetAllocationCount ();
+	for (size_t i = 0; i < valueCount; i++) {
+		values.push_back (DoubleValue::Create ((double) i + 2.0));
+	}
+	size_t reusedAllocations = GetAllocationCount () - allocationsBefore;
+
+	ASSERT (plainAllocations >= 2 * valueCount);
+	ASSERT (pooledAllocations * 5 <= plainAllocations);
+	ASSERT (reusedAllocations == 0);
+}
+
+TEST (ThreadCacheValueAllocationTest)
+{
+	const size_t threadCount = 4;
+	const size_t valueCount = 10000;
+	std::vector<std::vector<ValueConstPtr>> threadValues (threadCount);
+	std::vector<std::thread> threads;
+	for (size_t threadIndex = 0; threadIndex < threadCount; threadIndex++) {
+		threads.push_back (std::thread ([&, threadIndex] () {
+			std::vector<ValueConstPtr>& values = threadValues[threadIndex];
+			values.reserve (valueCount);
+			for (size_t i = 0; i < valueCount; i++) {
+				values.push_back (DoubleValue::Create ((double) i + 2.0));
+			}
+			for (size_t i = 0; i < valueCount; i += 2) {
+				values[i] = nullptr;
+			}
+		}));
+	}
+	for (std::thread& thread : threads) {
+		thread.join ();
+	}
+
+	for (const std::vector<ValueConstPtr>& values : threadValues) {
+		ASSERT (DoubleValue::Get (values.back ()) == (double) valueCount + 1.0);
+	}
+	threadValues.clear ();
+
+	// Half of the values were alive at the same time, so their blocks are
+	// back in the pools after the threads ended.
+	const size_t reusedValueCount = threadCount * valueCount / 2;
+	std::vector<ValueConstPtr> values;
+	values.reserve (reusedValueCount);
+	size_t allocationsBefore = GetAllocationCount ();
+	for (size_t i = 0; i < reusedValueCount; i++) {
+		values.push_back (DoubleValue::Create ((double) i + 2.0));
+	}
+	size_t reusedAllocations = GetAllocationCount () - allocationsBefore;
+	ASSERT (reusedAllocations == 0);
+}
+
+TEST (BoxedListValueAllocationTest)
+{
+	const size_t valueCount = 10000;
+	std::vector<double> items;
+	for (size_t i = 0; i < valueCount; i++) {
+		items.push_back ((double) i);
+	}
+
+	DoubleListValue listValue (items);
+	size_t allocationsBefore = GetAllocationCount ();
+	ASSERT (DoubleValue::Get (listValue.GetValue (valueCount - 1)) == (double) valueCount - 1.0);
+	size_t boxingAllocations = GetAllocationCount () - allocationsBefore;
+	ASSERT (boxingAllocations * 5 <= valueCount);
+}
+
+}
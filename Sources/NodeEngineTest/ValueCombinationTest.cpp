@@ -2,6 +2,10 @@
 #include "NE_NodeEngineUtilities.hpp"
 #include "NE_ValueCombination.hpp"
 #include "NE_SingleValues.hpp"
+#include "NE_NumberListValues.hpp"
+
+#include <atomic>
+#include <stdexcept>
 
 using namespace NE;
 
@@ -343,4 +347,178 @@ TEST (ValueCombinationTest3)
 	}
 }
 
+TEST (ValueCombinationIndexIteratorTest)
+{
+	{
+		std::vector<std::vector<size_t>> variations;
+		EnumerateVariationIndices ({ 1, 2, 1 }, [&] (const std::vector<size_t>& variation) {
+			variations.push_back (variation);
+			return true;
+		});
+
+		std::vector<std::vector<size_t>> combinations;
+		ValueCombinationIndexIterator iterator (ValueCombinationMode::CrossProduct, { 2, 3, 2 });
+		ASSERT (iterator.GetCombinationCount () == 12);
+		while (iterator.HasCombination ()) {
+			combinations.push_back (iterator.GetIndices ());
+			iterator.Next ();
+		}
+		ASSERT (combinations == variations);
+	}
+
+	{
+		std::vector<std::vector<size_t>> combinations;
+		ValueCombinationIndexIterator iterator (ValueCombinationMode::Longest, { 1, 3 });
+		ASSERT (iterator.GetCombinationCount () == 3);
+		while (iterator.HasCombination ()) {
+			combinations.push_back (iterator.GetIndices ());
+			iterator.Next ();
+		}
+		ASSERT (combinations == std::vector<std::vector<size_t>> ({ { 0, 0 }, { 0, 1 }, { 0, 2 } }));
+	}
+
+	{
+		std::vector<std::vector<size_t>> combinations;
+		ValueCombinationIndexIterator iterator (ValueCombinationMode::Shortest, { 2, 3 });
+		ASSERT (iterator.GetCombinationCount () == 2);
+		while (iterator.HasCombination ()) {
+			combinations.push_back (iterator.GetIndices ());
+			iterator.Next ();
+		}
+		ASSERT (combinations == std::vector<std::vector<size_t>> ({ { 0, 0 }, { 1, 1 } }));
+	}
+}
+
+static ValueConstPtr CreateNumberList (size_t count)
+{
+	DoubleListValuePtr list (new DoubleListValue ());
+	for (size_t i = 0; i < count; i++) {
+		list->PushItem ((double) i);
+	}
+	return list;
+}
+
+static ValueConstPtr CombineNumbers (const ValueCombination& combination)
+{
+	double result = 0.0;
+	for (size_t i = 0; i < combination.GetSize (); i++) {
+		result = result * 1000.0 + NumberValue::ToDouble (combination.GetValue (i));
+	}
+	return ValuePtr (new DoubleValue (result));
+}
+
+static std::vector<double> CombineNumbersSerial (ValueCombinationMode combinationMode, const std::vector<ValueConstPtr>& values)
+{
+	std::vector<double> results;
+	CombineValues (combinationMode, values, [&] (const ValueCombination& combination) {
+		results.push_back (DoubleValue::Get (CombineNumbers (combination)));
+		return true;
+	});
+	return results;
+}
+
+static std::vector<double> CombineNumbersParallel (ValueCombinationMode combinationMode, const std::vector<ValueConstPtr>& values, size_t chunkSize)
+{
+	std::vector<ValueConstPtr> resultValues;
+	if (!CombineValuesParallel (combinationMode, values, chunkSize, CombineNumbers, resultValues)) {
+		return {};
+	}
+	std::vector<double> results;
+	for (const ValueConstPtr& resultValue : resultValues) {
+		results.push_back (DoubleValue::Get (resultValue));
+	}
+	return results;
+}
+
+TEST (SetCombinationIndexTest)
+{
+	std::vector<ValueCombinationMode> combinationModes = { ValueCombinationMode::Shortest, ValueCombinationMode::Longest, ValueCombinationMode::CrossProduct };
+	for (ValueCombinationMode combinationMode : combinationModes) {
+		std::vector<std::vector<size_t>> combinations;
+		ValueCombinationIndexIterator iterator (combinationMode, { 3, 1, 4 });
+		while (iterator.HasCombination ()) {
+			combinations.push_back (iterator.GetIndices ());
+			iterator.Next ();
+		}
+		ASSERT (combinations.size () == iterator.GetCombinationCount ());
+		for (size_t i = combinations.size (); i > 0; i--) {
+			size_t combinationIndex = i - 1;
+			iterator.SetCombinationIndex (combinationIndex);
+			ASSERT (iterator.HasCombination ());
+			ASSERT (iterator.GetCombinationIndex () == combinationIndex);
+			ASSERT (iterator.GetIndices () == combinations[combinationIndex]);
+		}
+		iterator.SetCombinationIndex (iterator.GetCombinationCount ());
+		ASSERT (!iterator.HasCombination ());
+	}
+}
+
+TEST (ParallelCombineValuesTest)
+{
+	std::vector<ValueConstPtr> values = {
+		CreateNumberList (97),
+		ValuePtr (new IntValue (5)),
+		CreateNumberList (13)
+	};
+	std::vector<ValueCombinationMode> combinationModes = { ValueCombinationMode::Shortest, ValueCombinationMode::Longest, ValueCombinationMode::CrossProduct };
+	for (ValueCombinationMode combinationMode : combinationModes) {
+		std::vector<double> serialResults = CombineNumbersSerial (combinationMode, values);
+		ASSERT (!serialResults.empty ());
+		ASSERT (CombineNumbersParallel (combinationMode, values, 1) == serialResults);
+		ASSERT (CombineNumbersParallel (combinationMode, values, 7) == serialResults);
+		ASSERT (CombineNumbersParallel (combinationMode, values, 10000) == serialResults);
+	}
+}
+
+TEST (ParallelCombineValuesStoppingTest)
+{
+	std::vector<ValueConstPtr> values = { CreateNumberList (100), CreateNumberList (100) };
+	std::atomic<size_t> processedCount (0);
+	std::vector<ValueConstPtr> results;
+	bool success = CombineValuesParallel (ValueCombinationMode::CrossProduct, values, 16, [&] (const ValueCombination& combination) -> ValueConstPtr {
+		processedCount++;
+		if (NumberValue::ToDouble (combination.GetValue (0)) == 10.0) {
+			return nullptr;
+		}
+		return CombineNumbers (combination);
+	}, results);
+	ASSERT (!success);
+	ASSERT (results.empty ());
+	ASSERT (processedCount < 10000);
+}
+
+TEST (ParallelCombineValuesExceptionTest)
+{
+	std::vector<ValueConstPtr> values = { CreateNumberList (100), CreateNumberList (100) };
+	std::atomic<size_t> processedCount (0);
+	std::vector<ValueConstPtr> results;
+	bool isThrown = false;
+	try {
+		CombineValuesParallel (ValueCombinationMode::CrossProduct, values, 16, [&] (const ValueCombination& combination) -> ValueConstPtr {
+			processedCount++;
+			if (NumberValue::ToDouble (combination.GetValue (0)) == 10.0) {
+				throw std::runtime_error ("combination failed");
+			}
+			return CombineNumbers (combination);
+		}, results);
+	} catch (const std::runtime_error&) {
+		isThrown = true;
+	}
+	ASSERT (isThrown);
+	ASSERT (results.empty ());
+	ASSERT (processedCount < 10000);
+
+	std::vector<double> serialResults = CombineNumbersSerial (ValueCombinationMode::CrossProduct, values);
+	ASSERT (CombineNumbersParallel (ValueCombinationMode::CrossProduct, values, 16) == serialResults);
+}
+
+TEST (ParallelCombineValuesLargeInputTest)
+{
+	std::vector<ValueConstPtr> values = { CreateNumberList (300), CreateNumberList (300) };
+	std::vector<double> serialResults = CombineNumbersSerial (ValueCombinationMode::CrossProduct, values);
+	std::vector<double> parallelResults = CombineNumbersParallel (ValueCombinationMode::CrossProduct, values, 1024);
+	ASSERT (serialResults.size () == 90000);
+	ASSERT (parallelResults == serialResults);
+}
+
 }
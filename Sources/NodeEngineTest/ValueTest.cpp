@@ -1,6 +1,8 @@
 #include "SimpleTest.hpp"
 #include "NE_Value.hpp"
 #include "NE_SingleValues.hpp"
+#include "NE_NumberListValues.hpp"
+#include "NE_MemoryStream.hpp"
 
 using namespace NE;
 
@@ -21,6 +23,12 @@ public:
 	{
 	}
 
+	A& operator= (const A& rhs)
+	{
+		x = rhs.x;
+		return *this;
+	}
+
 	bool operator== (const A& rhs) const
 	{
 		return x == rhs.x;
@@ -190,4 +198,160 @@ TEST (FlattenTest)
 	ASSERT (IntValue::Get (flattenList->GetValue (2)) == 3);
 }
 
+TEST (NumberListValueTest)
+{
+	DoubleListValuePtr doubleList (new DoubleListValue ({ 1.0, 2.5, 3.0 }));
+	ListValuePtr boxedDoubleList (new ListValue ());
+	for (double item : doubleList->GetItems ()) {
+		boxedDoubleList->Push (ValuePtr (new DoubleValue (item)));
+	}
+
+	ASSERT (Value::IsType<ListValue> (doubleList.get ()));
+	ASSERT (IsComplexType<NumberValue> (doubleList));
+	ASSERT (doubleList->GetSize () == 3);
+	ASSERT (DoubleValue::Get (doubleList->GetValue (1)) == 2.5);
+	ASSERT (doubleList->ToString (DefaultStringSettings) == boxedDoubleList->ToString (DefaultStringSettings));
+
+	double sum = 0.0;
+	doubleList->Enumerate ([&] (const ValueConstPtr& val) {
+		sum += DoubleValue::Get (val);
+	});
+	ASSERT (sum == 6.5);
+
+	doubleList->Push (ValuePtr (new DoubleValue (4.0)));
+	doubleList->PushItem (5.0);
+	ASSERT (doubleList->GetSize () == 5);
+	ASSERT (DoubleValue::Get (doubleList->GetValue (4)) == 5.0);
+
+	ValuePtr clonedList = doubleList->Clone ();
+	ASSERT (Value::IsType<DoubleListValue> (clonedList));
+	ASSERT (Value::Cast<DoubleListValue> (clonedList)->GetItems () == doubleList->GetItems ());
+
+	IntListValuePtr intList (new IntListValue ());
+	intList->PushItem (1);
+	intList->Push (ValuePtr (new IntValue (2)));
+	ASSERT (IsComplexType<IntValue> (intList));
+	ASSERT (intList->GetItems () == std::vector<int> ({ 1, 2 }));
+	ASSERT (IntValue::Get (intList->GetValue (0)) == 1);
+}
+
+TEST (NumberListValueSerializationTest)
+{
+	IntListValue intList ({ 1, 2, 3 });
+	MemoryOutputStream outputStream;
+	WriteDynamicObject (outputStream, &intList);
+
+	MemoryInputStream inputStream (outputStream.GetBuffer ());
+	std::shared_ptr<Value> readValue (ReadDynamicObject<Value> (inputStream));
+	ASSERT (Value::IsType<IntListValue> (readValue));
+	ASSERT (Value::Cast<IntListValue> (readValue)->GetItems () == intList.GetItems ());
+}
+
+TEST (ValueKindTest)
+{
+	ValuePtr intValue (new IntValue (1));
+	ValuePtr doubleValue (new DoubleValue (2.0));
+	ValuePtr stringValue (new StringValue (L"a"));
+	ValuePtr aValue (new AValue (A (3)));
+	ASSERT (intValue->GetKind () == (SingleValueKind | NumberValueKind | IntValueKind));
+	ASSERT (aValue->GetKind () == SingleValueKind);
+
+	ASSERT (Value::IsType<SingleValue> (stringValue));
+	ASSERT (!Value::IsType<NumberValue> (stringValue));
+	ASSERT (Value::IsType<AValue> (aValue));
+	ASSERT (!Value::IsType<AValue> (intValue));
+	ASSERT (!Value::IsType<IntValue> (ValuePtr ()));
+	ASSERT (Value::Cast<DoubleValue> (doubleValue) == doubleValue);
+	ASSERT (Value::Cast<IntValue> (doubleValue) == nullptr);
+	ASSERT (Value::Cast<ListValue> (doubleValue.get ()) == nullptr);
+	ASSERT (Value::Cast<NumberValue> (intValue.get ())->ToInteger () == 1);
+	ASSERT (NumberValue::ToDouble (doubleValue) == 2.0);
+
+	ListValuePtr numberList (new ListValue ({ intValue, doubleValue }));
+	ASSERT ((numberList->GetItemKind () & NumberValueKind) != UnknownValueKind);
+	ASSERT (Value::Cast<ListValue> (ValuePtr (numberList)) == numberList);
+	ASSERT (IsComplexType<NumberValue> (numberList));
+	ASSERT (!IsComplexType<IntValue> (numberList));
+	ASSERT (!IsSingleType<NumberValue> (numberList));
+
+	numberList->Push (ListValuePtr (new ListValue ({ intValue })));
+	ASSERT (IsComplexType<NumberValue> (numberList));
+	numberList->Push (stringValue);
+	ASSERT (!IsComplexType<NumberValue> (numberList));
+
+	ListValuePtr aList (new ListValue ({ aValue, ListValuePtr (new ListValue ({ aValue })) }));
+	ASSERT (IsComplexType<AValue> (aList));
+	ASSERT (!IsComplexType<NumberValue> (aList));
+	ASSERT (IsSingleType<AValue> (ListValuePtr (new ListValue ({ aValue }))));
+
+	DoubleListValuePtr doubleList (new DoubleListValue ({ 1.0, 2.0 }));
+	ASSERT (Value::IsType<ListValue> (doubleList.get ()));
+	ASSERT (Value::IsType<DoubleListValue> (doubleList.get ()));
+	ASSERT (!Value::IsType<IntListValue> (doubleList.get ()));
+	ASSERT (IsComplexType<NumberValue> (doubleList));
+	ASSERT (IsComplexType<DoubleValue> (doubleList));
+	ASSERT (!IsComplexType<IntValue> (doubleList));
+	ASSERT (!IsComplexType<AValue> (doubleList));
+}
+
+TEST (LargeListValueKindTest)
+{
+	const size_t itemCount = 100000;
+	ListValuePtr list (new ListValue ());
+	for (size_t i = 0; i < itemCount; i++) {
+		list->Push (ValuePtr (new DoubleValue ((double) i)));
+	}
+	list->Push (ValuePtr (new IntValue (0)));
+
+	ASSERT (IsComplexType<NumberValue> (list));
+	ASSERT (!IsComplexType<DoubleValue> (list));
+
+	double sum = 0.0;
+	for (size_t i = 0; i < list->GetSize (); i++) {
+		sum += NumberValue::ToDouble (list->GetValue (i));
+	}
+	ASSERT (sum == (double) itemCount * (itemCount - 1) / 2.0);
+}
+
+TEST (ListValueSummaryTest)
+{
+	ValuePtr intValue (new IntValue (1));
+	ValuePtr doubleValue (new DoubleValue (2.0));
+
+	ListValuePtr emptyList (new ListValue ());
+	ASSERT (emptyList->GetDepth () == 1);
+	ASSERT (emptyList->GetFlatSize () == 0);
+	ASSERT (!IsComplexType<NumberValue> (emptyList));
+
+	ListValuePtr innerList (new ListValue ({ intValue, doubleValue }));
+	ListValuePtr outerList (new ListValue ({ intValue, innerList, IntListValuePtr (new IntListValue ({ 1, 2, 3 })) }));
+	ASSERT (innerList->GetDepth () == 1);
+	ASSERT (innerList->GetFlatSize () == 2);
+	ASSERT (outerList->GetDepth () == 2);
+	ASSERT (outerList->GetFlatSize () == 6);
+	ASSERT (IsComplexType<NumberValue> (outerList));
+	ASSERT (!IsComplexType<IntValue> (outerList));
+	ASSERT (!IsSingleType<NumberValue> (ListValuePtr (new ListValue ({ innerList }))));
+
+	ListValuePtr deepList (new ListValue ({ outerList }));
+	ASSERT (deepList->GetDepth () == 3);
+	ASSERT (deepList->GetFlatSize () == 6);
+	ASSERT (IsComplexType<NumberValue> (deepList));
+	deepList->Push (emptyList);
+	ASSERT (!IsComplexType<NumberValue> (deepList));
+	ASSERT (IsComplexType<ListValue> (deepList));
+
+	ListValuePtr intListList (new ListValue ({ IntListValuePtr (new IntListValue ({ 1 })), IntListValuePtr (new IntListValue ({ 2 })) }));
+	ASSERT (IsComplexType<IntListValue> (intListList));
+	ASSERT (IsComplexType<IntValue> (intListList));
+
+	ValueConstPtr flatList = FlattenValue (innerList);
+	ASSERT (flatList == innerList);
+	ValueConstPtr flattenedList = FlattenValue (deepList);
+	const ListValue* flattenedListValue = Value::Cast<ListValue> (flattenedList.get ());
+	ASSERT (flattenedListValue->GetSize () == 6);
+	ASSERT (flattenedListValue->GetDepth () == 1);
+	ASSERT (IntValue::Get (flattenedListValue->GetValue (5)) == 3);
+}
+
 }
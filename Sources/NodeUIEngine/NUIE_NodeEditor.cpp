@@ -189,6 +189,11 @@ void NodeEditor::New ()
 
 bool NodeEditor::Open (const std::wstring& fileName, const ExternalFileIO* externalFileIO, const ExternalHeaderIO* externalHeader)
 {
+	NE::MappedFileInputStream mappedInputStream (fileName);
+	if (mappedInputStream.GetStatus () == NE::Stream::Status::NoError) {
+		return Open (mappedInputStream, externalHeader);
+	}
+
 	std::vector<char> buffer;
 	if (DBGERROR (!externalFileIO->ReadBufferFromFile (fileName, buffer))) {
 		return false;
@@ -220,11 +225,17 @@ bool NodeEditor::Open (NE::InputStream& inputStream, const ExternalHeaderIO* ext
 
 	int readFileVersion = 0;
 	inputStream.Read (readFileVersion);
-	if (readFileVersion != FileVersion) {
+	if (readFileVersion != FileVersion && readFileVersion != FixedFormatFileVersion) {
 		return false;
 	}
 
-	if (DBGERROR (!uiManager.Open (uiEnvironment, inputStream))) {
+	NE::Stream::Format oldFormat = inputStream.GetFormat ();
+	if (readFileVersion == FileVersion) {
+		inputStream.SetFormat (NE::Stream::Format::Compact);
+	}
+	bool openSucceeded = uiManager.Open (uiEnvironment, inputStream);
+	inputStream.SetFormat (oldFormat);
+	if (DBGERROR (!openSucceeded)) {
 		return false;
 	}
 
@@ -235,6 +246,7 @@ bool NodeEditor::Open (NE::InputStream& inputStream, const ExternalHeaderIO* ext
 bool NodeEditor::Save (const std::wstring& fileName, const ExternalFileIO* externalFileIO, const ExternalHeaderIO* externalHeader) const
 {
 	NE::MemoryOutputStream outputStream;
+	outputStream.Reserve (NE::NodeManager::EstimateSerializedSize (uiManager.GetNodeCount (), NE::Stream::Format::Compact));
 	if (DBGERROR (!Save (outputStream, externalHeader))) {
 		return false;
 	}
@@ -256,7 +268,12 @@ bool NodeEditor::Save (NE::OutputStream& outputStream, const ExternalHeaderIO* e
 	outputStream.Write (NodeEditorFileMarker);
 	EngineVersion.Write (outputStream);
 	outputStream.Write (FileVersion);
-	if (DBGERROR (!uiManager.Save (outputStream))) {
+
+	NE::Stream::Format oldFormat = outputStream.GetFormat ();
+	outputStream.SetFormat (NE::Stream::Format::Compact);
+	bool saveSucceeded = uiManager.Save (outputStream);
+	outputStream.SetFormat (oldFormat);
+	if (DBGERROR (!saveSucceeded)) {
 		return false;
 	}
 	return true;
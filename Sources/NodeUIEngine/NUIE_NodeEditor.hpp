@@ -20,6 +20,9 @@ public:
 	virtual void	Write (NE::OutputStream& outputStream) const = 0;
 };
 
+// NodeEditor opens files by mapping them into memory, ReadBufferFromFile
+// is called only for files that can not be mapped.
+
 class ExternalFileIO
 {
 public:
@@ -96,11 +96,33 @@ NE::Stream::Status NodeFeature::Write (NE::OutputStream& outputStream) const
 	return outputStream.GetStatus ();
 }
 
+NodeFeaturePtr NodeFeature::CreateClone () const
+{
+	return nullptr;
+}
+
+NodeFeaturePtr NodeFeature::Clone (const NodeFeatureConstPtr& feature)
+{
+	return NE::CloneDynamicObject (feature);
+}
+
 UINodeFeatureSet::UINodeFeatureSet ()
 {
 
 }
 
+UINodeFeatureSet::UINodeFeatureSet (const UINodeFeatureSet& src) :
+	features (),
+	idToIndex ()
+{
+	for (const NodeFeaturePtr& feature : src.features) {
+		NodeFeaturePtr clonedFeature = NodeFeature::Clone (feature);
+		if (DBGVERIFY (clonedFeature != nullptr)) {
+			AddFeature (clonedFeature->GetId (), clonedFeature);
+		}
+	}
+}
+
 UINodeFeatureSet::~UINodeFeatureSet ()
 {
 
@@ -58,6 +58,9 @@ public:
 	virtual NE::Stream::Status	Read (NE::InputStream& inputStream);
 	virtual NE::Stream::Status	Write (NE::OutputStream& outputStream) const;
 
+	virtual NodeFeaturePtr		CreateClone () const;
+	static NodeFeaturePtr		Clone (const NodeFeatureConstPtr& feature);
+
 	template <class Type>
 	static Type* Cast (NodeFeature* feature);
 
@@ -103,6 +106,7 @@ class UINodeFeatureSet
 
 public:
 	UINodeFeatureSet ();
+	UINodeFeatureSet (const UINodeFeatureSet& src);
 	~UINodeFeatureSet ();
 
 	void						AddFeature (const FeatureId& featureId, const NodeFeaturePtr& feature);
@@ -272,7 +272,7 @@ void SetParametersMenuCommand::Do ()
 	if (uiEnvironment.GetEventHandlers ().OnParameterSettings (paramInterface)) {
 		CustomUndoableCommand command ([&] () {
 			paramInterface->ApplyChanges (uiManager, uiEnvironment, relevantNodes);
-		});
+		}, UndoScope (relevantNodes, false));
 		uiManager.ExecuteCommand (command);
 	}
 }
@@ -437,7 +437,7 @@ void SetGroupParametersMenuCommand::Do ()
 	if (uiEnvironment.GetEventHandlers ().OnParameterSettings (paramInterface)) {
 		CustomUndoableCommand command ([&] () {
 			paramInterface->ApplyChanges (uiManager);
-		});
+		}, UndoScope (NE::NodeCollection (), true));
 		uiManager.ExecuteCommand (command);
 	}
 }
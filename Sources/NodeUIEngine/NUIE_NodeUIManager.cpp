@@ -110,6 +110,11 @@ NodeUIManagerCommand::~NodeUIManagerCommand ()
 
 }
 
+UndoScope NodeUIManagerCommand::GetUndoScope (const NodeUIManager&) const
+{
+	return UndoScope ();
+}
+
 NodeUIManagerNodeInvalidator::NodeUIManagerNodeInvalidator (NodeUIManager& uiManager, UINodePtr& uiNode) :
 	UINodeInvalidator (),
 	uiManager (uiManager),
@@ -294,6 +299,11 @@ void NodeUIManager::EnumerateConnectedOutputSlots (const UIInputSlotConstPtr& in
 	});
 }
 
+size_t NodeUIManager::GetNodeCount () const
+{
+	return nodeManager.GetNodeCount ();
+}
+
 bool NodeUIManager::ContainsUINode (const NE::NodeId& nodeId) const
 {
 	return nodeManager.ContainsNode (nodeId);
@@ -622,7 +632,8 @@ bool NodeUIManager::Paste ()
 
 void NodeUIManager::SaveUndoState ()
 {
-	undoHandler.SaveUndoState (nodeManager);
+	undoHandler.SaveUndoState (nodeManager, UndoScope ());
+	undoHandler.FinishUndoState (nodeManager);
 }
 
 bool NodeUIManager::Undo (NE::EvaluationEnv& env)
@@ -643,6 +654,16 @@ bool NodeUIManager::Redo (NE::EvaluationEnv& env)
 	return success;
 }
 
+size_t NodeUIManager::GetUndoMemoryUsage () const
+{
+	return undoHandler.GetMemoryUsage ();
+}
+
+void NodeUIManager::SetUndoMemoryLimit (size_t memoryLimit)
+{
+	undoHandler.SetMemoryLimit (memoryLimit);
+}
+
 bool NodeUIManager::AddUINodeGroup (const UINodeGroupPtr& group)
 {
 	bool success = nodeManager.AddNodeGroup (group);
@@ -702,9 +723,12 @@ void NodeUIManager::EnumerateUINodeGroups (const std::function<bool (const UINod
 void NodeUIManager::ExecuteCommand (NodeUIManagerCommand& command)
 {
 	if (command.IsUndoable ()) {
-		SaveUndoState ();
+		undoHandler.SaveUndoState (nodeManager, command.GetUndoScope (*this));
+		command.Do (*this);
+		undoHandler.FinishUndoState (nodeManager);
+	} else {
+		command.Do (*this);
 	}
-	command.Do (*this);
 	status.RequestSave ();
 }
 
@@ -27,8 +27,9 @@ public:
 	NodeUIManagerCommand ();
 	virtual ~NodeUIManagerCommand ();
 
-	virtual bool IsUndoable () const = 0;
-	virtual void Do (NodeUIManager& uiManager) = 0;
+	virtual bool		IsUndoable () const = 0;
+	virtual UndoScope	GetUndoScope (const NodeUIManager& uiManager) const;
+	virtual void		Do (NodeUIManager& uiManager) = 0;
 };
 
 using NodeUIManagerCommandPtr = std::shared_ptr<NodeUIManagerCommand>;
@@ -92,6 +93,7 @@ public:
 	void						EnumerateConnectedInputSlots (const UIOutputSlotConstPtr& outputSlot, const std::function<void (UIInputSlotConstPtr)>& processor) const;
 	void						EnumerateConnectedOutputSlots (const UIInputSlotConstPtr& inputSlot, const std::function<void (UIOutputSlotConstPtr)>& processor) const;
 
+	size_t						GetNodeCount () const;
 	bool						ContainsUINode (const NE::NodeId& nodeId) const;
 	UINodePtr					GetUINode (const NE::NodeId& nodeId);
 	UINodeConstPtr				GetUINode (const NE::NodeId& nodeId) const;
@@ -142,6 +144,8 @@ public:
 	void						SaveUndoState ();
 	bool						Undo (NE::EvaluationEnv& env);
 	bool						Redo (NE::EvaluationEnv& env);
+	size_t						GetUndoMemoryUsage () const;
+	void						SetUndoMemoryLimit (size_t memoryLimit);
 
 	bool						AddUINodeGroup (const UINodeGroupPtr& group);
 	void						DeleteUINodeGroup (const UINodeGroupPtr& group);
@@ -3,6 +3,13 @@
 namespace NUIE
 {
 
+static void AddNodeToScope (NE::NodeCollection& nodes, const NE::NodeId& nodeId)
+{
+	if (!nodes.Contains (nodeId)) {
+		nodes.Insert (nodeId);
+	}
+}
+
 UndoableCommand::UndoableCommand () :
 	NodeUIManagerCommand ()
 {
@@ -40,6 +47,11 @@ AddNodeCommand::AddNodeCommand (const UINodePtr& uiNode, NE::EvaluationEnv& eval
 {
 }
 
+UndoScope AddNodeCommand::GetUndoScope (const NodeUIManager&) const
+{
+	return UndoScope (NE::NodeCollection (), false);
+}
+
 void AddNodeCommand::Do (NodeUIManager& uiManager)
 {
 	uiManager.AddNode (uiNode, evaluationEnv);
@@ -52,6 +64,11 @@ DeleteNodesCommand::DeleteNodesCommand (const NE::NodeCollection& nodes, NE::Eva
 {
 }
 
+UndoScope DeleteNodesCommand::GetUndoScope (const NodeUIManager&) const
+{
+	return UndoScope (nodes, false);
+}
+
 void DeleteNodesCommand::Do (NodeUIManager& uiManager)
 {
 	nodes.Enumerate ([&] (const NE::NodeId& nodeId) {
@@ -67,6 +84,11 @@ MoveNodesCommand::MoveNodesCommand (const NE::NodeCollection& nodes, const std::
 {
 }
 
+UndoScope MoveNodesCommand::GetUndoScope (const NodeUIManager&) const
+{
+	return UndoScope (nodes, false);
+}
+
 void MoveNodesCommand::Do (NodeUIManager& uiManager)
 {
 	if (DBGERROR (nodes.Count () != offsets.size ())) {
@@ -88,6 +110,14 @@ ConnectSlotsCommand::ConnectSlotsCommand (const UIOutputSlotConstPtr& outputSlot
 {
 }
 
+UndoScope ConnectSlotsCommand::GetUndoScope (const NodeUIManager&) const
+{
+	NE::NodeCollection nodes;
+	AddNodeToScope (nodes, outputSlot->GetOwnerNodeId ());
+	AddNodeToScope (nodes, inputSlot->GetOwnerNodeId ());
+	return UndoScope (nodes, false);
+}
+
 void ConnectSlotsCommand::Do (NodeUIManager& uiManager)
 {
 	uiManager.ConnectOutputSlotToInputSlot (outputSlot, inputSlot);
@@ -101,6 +131,15 @@ ReconnectSlotsCommand::ReconnectSlotsCommand (const UIOutputSlotConstPtr& output
 {
 }
 
+UndoScope ReconnectSlotsCommand::GetUndoScope (const NodeUIManager&) const
+{
+	NE::NodeCollection nodes;
+	AddNodeToScope (nodes, outputSlot->GetOwnerNodeId ());
+	AddNodeToScope (nodes, oldInputSlot->GetOwnerNodeId ());
+	AddNodeToScope (nodes, newInputSlot->GetOwnerNodeId ());
+	return UndoScope (nodes, false);
+}
+
 void ReconnectSlotsCommand::Do (NodeUIManager& uiManager)
 {
 	uiManager.DisconnectOutputSlotFromInputSlot (outputSlot, oldInputSlot);
@@ -114,6 +153,14 @@ DisconnectSlotsCommand::DisconnectSlotsCommand (const UIOutputSlotConstPtr& outp
 {
 }
 
+UndoScope DisconnectSlotsCommand::GetUndoScope (const NodeUIManager&) const
+{
+	NE::NodeCollection nodes;
+	AddNodeToScope (nodes, outputSlot->GetOwnerNodeId ());
+	AddNodeToScope (nodes, inputSlot->GetOwnerNodeId ());
+	return UndoScope (nodes, false);
+}
+
 void DisconnectSlotsCommand::Do (NodeUIManager& uiManager)
 {
 	uiManager.DisconnectOutputSlotFromInputSlot (outputSlot, inputSlot);
@@ -125,6 +172,16 @@ DisconnectAllInputSlotsCommand::DisconnectAllInputSlotsCommand (const UIOutputSl
 {
 }
 
+UndoScope DisconnectAllInputSlotsCommand::GetUndoScope (const NodeUIManager& uiManager) const
+{
+	NE::NodeCollection nodes;
+	AddNodeToScope (nodes, outputSlot->GetOwnerNodeId ());
+	uiManager.EnumerateConnectedInputSlots (outputSlot, [&] (UIInputSlotConstPtr inputSlot) {
+		AddNodeToScope (nodes, inputSlot->GetOwnerNodeId ());
+	});
+	return UndoScope (nodes, false);
+}
+
 void DisconnectAllInputSlotsCommand::Do (NodeUIManager& uiManager)
 {
 	uiManager.DisconnectAllInputSlotsFromOutputSlot (outputSlot);
@@ -136,6 +193,16 @@ DisconnectAllOutputSlotsCommand::DisconnectAllOutputSlotsCommand (const UIInputS
 {
 }
 
+UndoScope DisconnectAllOutputSlotsCommand::GetUndoScope (const NodeUIManager& uiManager) const
+{
+	NE::NodeCollection nodes;
+	AddNodeToScope (nodes, inputSlot->GetOwnerNodeId ());
+	uiManager.EnumerateConnectedOutputSlots (inputSlot, [&] (UIOutputSlotConstPtr outputSlot) {
+		AddNodeToScope (nodes, outputSlot->GetOwnerNodeId ());
+	});
+	return UndoScope (nodes, false);
+}
+
 void DisconnectAllOutputSlotsCommand::Do (NodeUIManager& uiManager)
 {
 	uiManager.DisconnectAllOutputSlotsFromInputSlot (inputSlot);
@@ -158,6 +225,11 @@ PasteNodesCommand::PasteNodesCommand (const Point& position) :
 {
 }
 
+UndoScope PasteNodesCommand::GetUndoScope (const NodeUIManager&) const
+{
+	return UndoScope (NE::NodeCollection (), false);
+}
+
 void PasteNodesCommand::Do (NodeUIManager& uiManager)
 {
 	std::unordered_set<NE::NodeId> oldNodes;
@@ -202,6 +274,11 @@ AddGroupCommand::AddGroupCommand (const UINodeGroupPtr& uiGroup, const NE::NodeC
 
 }
 
+UndoScope AddGroupCommand::GetUndoScope (const NodeUIManager&) const
+{
+	return UndoScope (NE::NodeCollection (), true);
+}
+
 void AddGroupCommand::Do (NodeUIManager& uiManager)
 {
 	uiManager.AddUINodeGroup (uiGroup);
@@ -215,6 +292,11 @@ DeleteGroupCommand::DeleteGroupCommand (const UINodeGroupPtr& uiGroup) :
 
 }
 
+UndoScope DeleteGroupCommand::GetUndoScope (const NodeUIManager&) const
+{
+	return UndoScope (NE::NodeCollection (), true);
+}
+
 void DeleteGroupCommand::Do (NodeUIManager& uiManager)
 {
 	uiManager.DeleteUINodeGroup (uiGroup);
@@ -228,6 +310,11 @@ AddNodesToGroupCommand::AddNodesToGroupCommand (const UINodeGroupPtr& uiGroup, c
 
 }
 
+UndoScope AddNodesToGroupCommand::GetUndoScope (const NodeUIManager&) const
+{
+	return UndoScope (NE::NodeCollection (), true);
+}
+
 void AddNodesToGroupCommand::Do (NodeUIManager& uiManager)
 {
 	uiManager.AddNodesToUIGroup (uiGroup, nodes);
@@ -240,6 +327,11 @@ RemoveNodesFromGroupCommand::RemoveNodesFromGroupCommand (const NE::NodeCollecti
 
 }
 
+UndoScope RemoveNodesFromGroupCommand::GetUndoScope (const NodeUIManager&) const
+{
+	return UndoScope (NE::NodeCollection (), true);
+}
+
 void RemoveNodesFromGroupCommand::Do (NodeUIManager& uiManager)
 {
 	uiManager.RemoveNodesFromUIGroup (nodes);
@@ -269,9 +361,20 @@ void RedoCommand::Do (NodeUIManager& uiManager)
 
 
 CustomUndoableCommand::CustomUndoableCommand (const std::function<void ()>& func) :
+	CustomUndoableCommand (func, UndoScope ())
+{
+}
+
+CustomUndoableCommand::CustomUndoableCommand (const std::function<void ()>& func, const UndoScope& scope) :
 	UndoableCommand (),
-	func (func)
+	func (func),
+	scope (scope)
+{
+}
+
+UndoScope CustomUndoableCommand::GetUndoScope (const NodeUIManager&) const
 {
+	return scope;
 }
 
 void CustomUndoableCommand::Do (NodeUIManager&)
@@ -29,6 +29,7 @@ class AddNodeCommand : public UndoableCommand
 public:
 	AddNodeCommand (const UINodePtr& uiNode, NE::EvaluationEnv& evaluationEnv);
 
+	virtual UndoScope GetUndoScope (const NodeUIManager& uiManager) const override;
 	virtual void Do (NodeUIManager& uiManager) override;
 
 private:
@@ -41,6 +42,7 @@ class DeleteNodesCommand : public UndoableCommand
 public:
 	DeleteNodesCommand (const NE::NodeCollection& nodes, NE::EvaluationEnv& evaluationEnv);
 
+	virtual UndoScope GetUndoScope (const NodeUIManager& uiManager) const override;
 	virtual void Do (NodeUIManager& uiManager) override;
 
 private:
@@ -53,6 +55,7 @@ class MoveNodesCommand : public UndoableCommand
 public:
 	MoveNodesCommand (const NE::NodeCollection& nodes, const std::vector<Point>& offsets);
 
+	virtual UndoScope GetUndoScope (const NodeUIManager& uiManager) const override;
 	virtual void Do (NodeUIManager& uiManager) override;
 
 private:
@@ -65,6 +68,7 @@ class ConnectSlotsCommand : public UndoableCommand
 public:
 	ConnectSlotsCommand (const UIOutputSlotConstPtr& outputSlot, const UIInputSlotConstPtr& inputSlot);
 
+	virtual UndoScope GetUndoScope (const NodeUIManager& uiManager) const override;
 	virtual void Do (NodeUIManager& uiManager) override;
 
 private:
@@ -77,6 +81,7 @@ class ReconnectSlotsCommand : public UndoableCommand
 public:
 	ReconnectSlotsCommand (const UIOutputSlotConstPtr& outputSlot, const UIInputSlotConstPtr& oldInputSlot, const UIInputSlotConstPtr& newInputSlot);
 
+	virtual UndoScope GetUndoScope (const NodeUIManager& uiManager) const override;
 	virtual void Do (NodeUIManager& uiManager) override;
 
 private:
@@ -90,6 +95,7 @@ class DisconnectSlotsCommand : public UndoableCommand
 public:
 	DisconnectSlotsCommand (const UIOutputSlotConstPtr& outputSlot, const UIInputSlotConstPtr& inputSlot);
 
+	virtual UndoScope GetUndoScope (const NodeUIManager& uiManager) const override;
 	virtual void Do (NodeUIManager& uiManager) override;
 
 private:
@@ -102,6 +108,7 @@ class DisconnectAllInputSlotsCommand : public UndoableCommand
 public:
 	DisconnectAllInputSlotsCommand (const UIOutputSlotConstPtr& outputSlot);
 
+	virtual UndoScope GetUndoScope (const NodeUIManager& uiManager) const override;
 	virtual void Do (NodeUIManager& uiManager) override;
 
 private:
@@ -113,6 +120,7 @@ class DisconnectAllOutputSlotsCommand : public UndoableCommand
 public:
 	DisconnectAllOutputSlotsCommand (const UIInputSlotConstPtr& inputSlot);
 
+	virtual UndoScope GetUndoScope (const NodeUIManager& uiManager) const override;
 	virtual void Do (NodeUIManager& uiManager) override;
 
 private:
@@ -135,6 +143,7 @@ class PasteNodesCommand : public UndoableCommand
 public:
 	PasteNodesCommand (const Point& position);
 
+	virtual UndoScope GetUndoScope (const NodeUIManager& uiManager) const override;
 	virtual void Do (NodeUIManager& uiManager) override;
 
 private:
@@ -146,6 +155,7 @@ class AddGroupCommand : public UndoableCommand
 public:
 	AddGroupCommand (const UINodeGroupPtr& uiGroup, const NE::NodeCollection& nodes);
 
+	virtual UndoScope GetUndoScope (const NodeUIManager& uiManager) const override;
 	virtual void Do (NodeUIManager& uiManager) override;
 
 private:
@@ -158,6 +168,7 @@ class DeleteGroupCommand : public UndoableCommand
 public:
 	DeleteGroupCommand (const UINodeGroupPtr& uiGroup);
 
+	virtual UndoScope GetUndoScope (const NodeUIManager& uiManager) const override;
 	virtual void Do (NodeUIManager& uiManager) override;
 
 private:
@@ -169,6 +180,7 @@ class AddNodesToGroupCommand : public UndoableCommand
 public:
 	AddNodesToGroupCommand (const UINodeGroupPtr& uiGroup, const NE::NodeCollection& nodes);
 
+	virtual UndoScope GetUndoScope (const NodeUIManager& uiManager) const override;
 	virtual void Do (NodeUIManager& uiManager) override;
 
 private:
@@ -181,6 +193,7 @@ class RemoveNodesFromGroupCommand : public UndoableCommand
 public:
 	RemoveNodesFromGroupCommand (const NE::NodeCollection& nodes);
 
+	virtual UndoScope GetUndoScope (const NodeUIManager& uiManager) const override;
 	virtual void Do (NodeUIManager& uiManager) override;
 
 private:
@@ -213,11 +226,14 @@ class CustomUndoableCommand : public UndoableCommand
 {
 public:
 	CustomUndoableCommand (const std::function<void ()>& func);
+	CustomUndoableCommand (const std::function<void ()>& func, const UndoScope& scope);
 
+	virtual UndoScope GetUndoScope (const NodeUIManager& uiManager) const override;
 	virtual void Do (NodeUIManager& uiManager) override;
 
 private:
-	std::function<void ()> func;
+	std::function<void ()>	func;
+	UndoScope				scope;
 };
 
 }
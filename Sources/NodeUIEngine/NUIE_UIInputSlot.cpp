@@ -39,6 +39,11 @@ void UIInputSlot::RegisterCommands (InputSlotCommandRegistrator&) const
 
 }
 
+NE::InputSlotPtr UIInputSlot::CreateClone () const
+{
+	return NE::InputSlotPtr (new UIInputSlot (*this));
+}
+
 NE::Stream::Status UIInputSlot::Read (NE::InputStream& inputStream)
 {
 	NE::ObjectHeader header (inputStream);
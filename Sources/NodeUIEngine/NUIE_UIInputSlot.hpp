@@ -22,6 +22,8 @@ public:
 
 	virtual void				RegisterCommands (InputSlotCommandRegistrator& commandRegistrator) const;
 	
+	virtual NE::InputSlotPtr	CreateClone () const override;
+
 	virtual NE::Stream::Status	Read (NE::InputStream& inputStream) override;
 	virtual NE::Stream::Status	Write (NE::OutputStream& outputStream) const override;
 
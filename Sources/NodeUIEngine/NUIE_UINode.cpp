@@ -39,6 +39,16 @@ UINode::UINode (const std::wstring& nodeName, const Point& nodePosition) :
 
 }
 
+UINode::UINode (const UINode& src) :
+	Node (src),
+	nodeName (src.nodeName),
+	nodePosition (src.nodePosition),
+	nodeFeatureSet (src.nodeFeatureSet),
+	nodeDrawingImage ()
+{
+
+}
+
 UINode::~UINode ()
 {
 
@@ -52,6 +62,7 @@ const std::wstring& UINode::GetNodeName () const
 void UINode::SetNodeName (const std::wstring& newNodeName)
 {
 	nodeName = newNodeName;
+	InvalidateContentHash ();
 }
 
 const Point& UINode::GetNodePosition () const
@@ -62,6 +73,7 @@ const Point& UINode::GetNodePosition () const
 void UINode::SetNodePosition (const Point& newPosition)
 {
 	nodePosition = newPosition;
+	InvalidateContentHash ();
 }
 
 void UINode::Draw (NodeUIDrawingEnvironment& env) const
@@ -81,6 +93,7 @@ Rect UINode::GetNodeRect (NodeUIDrawingEnvironment& env) const
 void UINode::InvalidateDrawing () const
 {
 	nodeDrawingImage.Reset ();
+	InvalidateContentHash ();
 }
 
 Point UINode::GetInputSlotConnPosition (NodeUIDrawingEnvironment& env, const NE::SlotId& slotId) const
@@ -217,7 +230,7 @@ void UINode::RegisterCommands (NodeCommandRegistrator& commandRegistrator) const
 
 void UINode::OnFeatureChange (const FeatureId&, NE::EvaluationEnv&) const
 {
-
+	InvalidateContentHash ();
 }
 
 void UINode::OnAdd (NE::EvaluationEnv&) const
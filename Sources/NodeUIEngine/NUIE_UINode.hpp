@@ -94,6 +94,8 @@ public:
 	void EnumerateUISlots (const std::function<bool (const SlotConstType&)>& processor) const;
 
 protected:
+	UINode (const UINode& src);
+
 	virtual void				DrawInplace (NodeUIDrawingEnvironment& env) const;
 	bool						RegisterUIInputSlot (const UIInputSlotPtr& newInputSlot);
 	bool						RegisterUIOutputSlot (const UIOutputSlotPtr& newOutputSlot);
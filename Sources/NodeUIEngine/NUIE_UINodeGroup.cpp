@@ -101,6 +101,13 @@ void UINodeGroup::InvalidateGroupDrawing () const
 	drawingImage.Reset ();
 }
 
+NE::NodeGroupPtr UINodeGroup::CreateClone () const
+{
+	UINodeGroupPtr result (new UINodeGroup (*this));
+	result->InvalidateGroupDrawing ();
+	return result;
+}
+
 NE::Stream::Status UINodeGroup::Read (NE::InputStream& inputStream)
 {
 	NE::ObjectHeader header (inputStream);
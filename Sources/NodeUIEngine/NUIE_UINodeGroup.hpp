@@ -50,6 +50,8 @@ public:
 	void						Draw (NodeUIDrawingEnvironment& env, const NodeRectGetter& rectGetter, const NE::NodeCollection& nodes) const;
 	void						InvalidateGroupDrawing () const;
 
+	virtual NE::NodeGroupPtr	CreateClone () const override;
+
 	virtual NE::Stream::Status	Read (NE::InputStream& inputStream) override;
 	virtual NE::Stream::Status	Write (NE::OutputStream& outputStream) const override;
 
@@ -39,6 +39,11 @@ void UIOutputSlot::RegisterCommands (OutputSlotCommandRegistrator&) const
 
 }
 
+NE::OutputSlotPtr UIOutputSlot::CreateClone () const
+{
+	return NE::OutputSlotPtr (new UIOutputSlot (*this));
+}
+
 NE::Stream::Status UIOutputSlot::Read (NE::InputStream& inputStream)
 {
 	NE::ObjectHeader header (inputStream);
@@ -1,25 +1,205 @@
 #include "NUIE_UndoHandler.hpp"
+#include "NE_MemoryStream.hpp"
 #include "NE_Debug.hpp"
 
 namespace NUIE
 {
 
-static void SaveAndAddState (const NE::NodeManager& nodeManager, std::vector<std::shared_ptr<NE::NodeManager>>& stack)
+static const size_t DefaultMemoryLimit = 256 * 1024 * 1024;
+
+class CompleteUndoStep : public UndoStep
+{
+public:
+	CompleteUndoStep (const NE::NodeManager& nodeManager, NE::CompressionMode compression) :
+		UndoStep (),
+		compression (compression),
+		savedState ()
+	{
+		SaveState (nodeManager, savedState);
+	}
+
+	virtual void Finish (const NE::NodeManager&) override
+	{
+
+	}
+
+	virtual bool Undo (NE::NodeManager& targetNodeManager, NE::MergeEventHandler& eventHandler) override
+	{
+		return SwapState (targetNodeManager, eventHandler);
+	}
+
+	virtual bool Redo (NE::NodeManager& targetNodeManager, NE::MergeEventHandler& eventHandler) override
+	{
+		return SwapState (targetNodeManager, eventHandler);
+	}
+
+	virtual size_t GetSize () const override
+	{
+		return savedState.GetSize ();
+	}
+
+private:
+	bool SaveState (const NE::NodeManager& nodeManager, NE::CompressedBuffer& state) const
+	{
+		NE::MemoryOutputStream outputStream;
+		outputStream.SetFormat (NE::Stream::Format::Compact);
+		outputStream.Reserve (NE::NodeManager::EstimateSerializedSize (nodeManager.GetNodeCount (), NE::Stream::Format::Compact));
+		if (DBGERROR (nodeManager.Write (outputStream) != NE::Stream::Status::NoError)) {
+			return false;
+		}
+		state.Set (outputStream.GetBuffer (), compression);
+		return true;
+	}
+
+	bool SwapState (NE::NodeManager& targetNodeManager, NE::MergeEventHandler& eventHandler)
+	{
+		std::vector<char> stateData;
+		if (DBGERROR (!savedState.Get (stateData))) {
+			return false;
+		}
+
+		NE::NodeManager state;
+		NE::MemoryInputStream inputStream (stateData);
+		inputStream.SetFormat (NE::Stream::Format::Compact);
+		if (DBGERROR (state.Read (inputStream) != NE::Stream::Status::NoError)) {
+			return false;
+		}
+
+		NE::CompressedBuffer currentState;
+		if (!SaveState (targetNodeManager, currentState)) {
+			return false;
+		}
+
+		bool success = NE::NodeManagerMerge::UpdateNodeManager (state, targetNodeManager, eventHandler);
+		std::swap (savedState, currentState);
+		return success;
+	}
+
+	NE::CompressionMode		compression;
+	NE::CompressedBuffer	savedState;
+};
+
+class PartialUndoStep : public UndoStep
 {
-	std::shared_ptr<NE::NodeManager> undoState (new NE::NodeManager ());
-	NE::NodeManager::Clone (nodeManager, *undoState.get ());
-	stack.push_back (undoState);
+public:
+	PartialUndoStep (const NE::NodeManager& nodeManager, const UndoScope& scope, NE::CompressionMode compression) :
+		UndoStep (),
+		compression (compression),
+		nodes (scope.GetNodes ()),
+		firstNewNodeId (nodeManager.GetNextNodeId ()),
+		stateBefore (),
+		stateAfter ()
+	{
+		stateBefore.Save (nodeManager, nodes, scope.IncludesGroups (), compression);
+	}
+
+	virtual void Finish (const NE::NodeManager& nodeManager) override
+	{
+		NE::NodeIdType lastNewNodeId = nodeManager.GetNextNodeId ().GetUniqueId ();
+		for (NE::NodeIdType uniqueId = firstNewNodeId.GetUniqueId (); uniqueId < lastNewNodeId; uniqueId++) {
+			NE::NodeId nodeId (uniqueId);
+			if (nodeManager.ContainsNode (nodeId)) {
+				nodes.Insert (nodeId);
+			}
+		}
+		stateAfter.Save (nodeManager, nodes, stateBefore.HasGroups (), compression);
+	}
+
+	virtual bool Undo (NE::NodeManager& targetNodeManager, NE::MergeEventHandler& eventHandler) override
+	{
+		return stateBefore.Restore (targetNodeManager, nodes, eventHandler);
+	}
+
+	virtual bool Redo (NE::NodeManager& targetNodeManager, NE::MergeEventHandler& eventHandler) override
+	{
+		return stateAfter.Restore (targetNodeManager, nodes, eventHandler);
+	}
+
+	virtual size_t GetSize () const override
+	{
+		return nodes.Count () * sizeof (NE::NodeId) + stateBefore.GetSize () + stateAfter.GetSize ();
+	}
+
+private:
+	NE::CompressionMode				compression;
+	NE::NodeCollection				nodes;
+	NE::NodeId						firstNewNodeId;
+	NE::PartialNodeManagerState		stateBefore;
+	NE::PartialNodeManagerState		stateAfter;
+};
+
+UndoScope::UndoScope () :
+	isComplete (true),
+	nodes (),
+	includesGroups (true)
+{
+
 }
 
-UndoHandler::UndoHandler ()
+UndoScope::UndoScope (const NE::NodeCollection& nodes, bool includesGroups) :
+	isComplete (false),
+	nodes (nodes),
+	includesGroups (includesGroups)
 {
 
 }
 
-void UndoHandler::SaveUndoState (const NE::NodeManager& nodeManager)
+UndoScope::~UndoScope ()
+{
+
+}
+
+bool UndoScope::IsComplete () const
+{
+	return isComplete;
+}
+
+const NE::NodeCollection& UndoScope::GetNodes () const
+{
+	return nodes;
+}
+
+bool UndoScope::IncludesGroups () const
+{
+	return includesGroups;
+}
+
+UndoStep::UndoStep ()
+{
+
+}
+
+UndoStep::~UndoStep ()
+{
+
+}
+
+UndoHandler::UndoHandler () :
+	undoStack (),
+	redoStack (),
+	memoryLimit (DefaultMemoryLimit),
+	compression (NE::CompressionMode::LZ)
+{
+
+}
+
+void UndoHandler::SaveUndoState (const NE::NodeManager& nodeManager, const UndoScope& scope)
 {
 	redoStack.clear ();
-	SaveAndAddState (nodeManager, undoStack);
+	if (scope.IsComplete ()) {
+		undoStack.push_back (UndoStepPtr (new CompleteUndoStep (nodeManager, compression)));
+	} else {
+		undoStack.push_back (UndoStepPtr (new PartialUndoStep (nodeManager, scope, compression)));
+	}
+}
+
+void UndoHandler::FinishUndoState (const NE::NodeManager& nodeManager)
+{
+	if (DBGERROR (undoStack.empty ())) {
+		return;
+	}
+	undoStack.back ()->Finish (nodeManager);
+	DropOldSteps ();
 }
 
 bool UndoHandler::Undo (NE::NodeManager& targetNodeManager, NE::MergeEventHandler& eventHandler)
@@ -28,12 +208,11 @@ bool UndoHandler::Undo (NE::NodeManager& targetNodeManager, NE::MergeEventHandle
 		return false;
 	}
 
-	SaveAndAddState (targetNodeManager, redoStack);
-
-	std::shared_ptr<NE::NodeManager> undoState = undoStack.back ();
+	UndoStepPtr undoStep = undoStack.back ();
 	undoStack.pop_back ();
+	redoStack.push_back (undoStep);
 
-	return NE::NodeManagerMerge::UpdateNodeManager (*undoState.get (), targetNodeManager, eventHandler);
+	return undoStep->Undo (targetNodeManager, eventHandler);
 }
 
 bool UndoHandler::Redo (NE::NodeManager& targetNodeManager, NE::MergeEventHandler& eventHandler)
@@ -42,10 +221,11 @@ bool UndoHandler::Redo (NE::NodeManager& targetNodeManager, NE::MergeEventHandle
 		return false;
 	}
 
-	SaveAndAddState (targetNodeManager, undoStack);
-	std::shared_ptr<NE::NodeManager> redoState = redoStack.back ();
+	UndoStepPtr redoStep = redoStack.back ();
 	redoStack.pop_back ();
-	return NE::NodeManagerMerge::UpdateNodeManager (*redoState.get (), targetNodeManager, eventHandler);
+	undoStack.push_back (redoStep);
+
+	return redoStep->Redo (targetNodeManager, eventHandler);
 }
 
 void UndoHandler::Clear ()
@@ -54,4 +234,61 @@ void UndoHandler::Clear ()
 	redoStack.clear ();
 }
 
+size_t UndoHandler::GetUndoStepCount () const
+{
+	return undoStack.size ();
+}
+
+size_t UndoHandler::GetRedoStepCount () const
+{
+	return redoStack.size ();
+}
+
+size_t UndoHandler::GetMemoryUsage () const
+{
+	size_t memoryUsage = 0;
+	for (const UndoStepPtr& undoStep : undoStack) {
+		memoryUsage += undoStep->GetSize ();
+	}
+	for (const UndoStepPtr& redoStep : redoStack) {
+		memoryUsage += redoStep->GetSize ();
+	}
+	return memoryUsage;
+}
+
+size_t UndoHandler::GetMemoryLimit () const
+{
+	return memoryLimit;
+}
+
+void UndoHandler::SetMemoryLimit (size_t newMemoryLimit)
+{
+	memoryLimit = newMemoryLimit;
+	DropOldSteps ();
+}
+
+NE::CompressionMode UndoHandler::GetCompression () const
+{
+	return compression;
+}
+
+void UndoHandler::SetCompression (NE::CompressionMode newCompression)
+{
+	compression = newCompression;
+}
+
+void UndoHandler::DropOldSteps ()
+{
+	size_t memoryUsage = GetMemoryUsage ();
+	while (memoryUsage > memoryLimit && undoStack.size () + redoStack.size () > 1) {
+		if (!undoStack.empty ()) {
+			memoryUsage -= undoStack.front ()->GetSize ();
+			undoStack.pop_front ();
+		} else {
+			memoryUsage -= redoStack.front ()->GetSize ();
+			redoStack.erase (redoStack.begin ());
+		}
+	}
+}
+
 }
@@ -3,25 +3,78 @@
 
 #include "NE_NodeManager.hpp"
 #include "NE_NodeManagerMerge.hpp"
+#include "NE_NodeCollection.hpp"
+#include "NE_Compression.hpp"
 
 #include <vector>
+#include <deque>
 
 namespace NUIE
 {
 
+class UndoScope
+{
+public:
+	UndoScope ();
+	UndoScope (const NE::NodeCollection& nodes, bool includesGroups);
+	~UndoScope ();
+
+	bool						IsComplete () const;
+	const NE::NodeCollection&	GetNodes () const;
+	bool						IncludesGroups () const;
+
+private:
+	bool				isComplete;
+	NE::NodeCollection	nodes;
+	bool				includesGroups;
+};
+
+class UndoStep
+{
+public:
+	UndoStep ();
+	virtual ~UndoStep ();
+
+	virtual void	Finish (const NE::NodeManager& nodeManager) = 0;
+	virtual bool	Undo (NE::NodeManager& targetNodeManager, NE::MergeEventHandler& eventHandler) = 0;
+	virtual bool	Redo (NE::NodeManager& targetNodeManager, NE::MergeEventHandler& eventHandler) = 0;
+	virtual size_t	GetSize () const = 0;
+};
+
+using UndoStepPtr = std::shared_ptr<UndoStep>;
+
+// The undo history is stored in serialized form. When the undo and redo
+// steps together grow over the memory limit, the oldest undo steps are
+// dropped first, then the redo steps farthest from the current state, but
+// one step is always kept.
+
 class UndoHandler
 {
 public:
 	UndoHandler ();
 
-	void	SaveUndoState (const NE::NodeManager& nodeManager);
-	bool	Undo (NE::NodeManager& targetNodeManager, NE::MergeEventHandler& eventHandler);
-	bool	Redo (NE::NodeManager& targetNodeManager, NE::MergeEventHandler& eventHandler);
-	void	Clear ();
+	void				SaveUndoState (const NE::NodeManager& nodeManager, const UndoScope& scope);
+	void				FinishUndoState (const NE::NodeManager& nodeManager);
+	bool				Undo (NE::NodeManager& targetNodeManager, NE::MergeEventHandler& eventHandler);
+	bool				Redo (NE::NodeManager& targetNodeManager, NE::MergeEventHandler& eventHandler);
+	void				Clear ();
+
+	size_t				GetUndoStepCount () const;
+	size_t				GetRedoStepCount () const;
+	size_t				GetMemoryUsage () const;
+
+	size_t				GetMemoryLimit () const;
+	void				SetMemoryLimit (size_t newMemoryLimit);
+	NE::CompressionMode	GetCompression () const;
+	void				SetCompression (NE::CompressionMode newCompression);
 
 private:
-	std::vector<std::shared_ptr<NE::NodeManager>>	undoStack;
-	std::vector<std::shared_ptr<NE::NodeManager>>	redoStack;
+	void				DropOldSteps ();
+
+	std::deque<UndoStepPtr>		undoStack;
+	std::vector<UndoStepPtr>	redoStack;
+	size_t						memoryLimit;
+	NE::CompressionMode			compression;
 };
 
 }
@@ -26,6 +26,7 @@ private:
 
 extern const Version EngineVersion;
 extern const int FileVersion;
+extern const int FixedFormatFileVersion;
 
 }
 
@@ -1,5 +1,6 @@
 #include "TestAppNodes.hpp"
 #include "NE_ValueCombination.hpp"
+#include "NE_ValueAllocator.hpp"
 #include "NUIE_NodeParameters.hpp"
 #include "NUIE_NodeCommonParameters.hpp"
 #include "TestAppValues.hpp"
@@ -152,6 +153,11 @@ void DrawableNode::ProcessCalculatedValue (const NE::ValueConstPtr& value, NE::E
 	}
 }
 
+bool DrawableNode::IsThreadSafe () const
+{
+	return false;
+}
+
 void DrawableNode::OnCalculated (const NE::ValueConstPtr&, NE::EvaluationEnv& env) const
 {
 	RemoveItem (env);
@@ -171,6 +177,7 @@ void DrawableNode::OnDisabled (NE::EvaluationEnv& env) const
 
 void DrawableNode::OnFeatureChange (const NUIE::FeatureId& featureId, NE::EvaluationEnv& env) const
 {
+	BI::BasicUINode::OnFeatureChange (featureId, env);
 	if (featureId == BI::EnableDisableFeatureId) {
 		std::shared_ptr<BI::EnableDisableFeature> enableDisable = GetEnableDisableFeature (this);
 		if (enableDisable->GetState () == BI::EnableDisableFeature::State::Enabled) {
@@ -276,18 +283,20 @@ NE::ValueConstPtr PointNode::Calculate (NE::EvaluationEnv& env) const
 		return nullptr;
 	}
 
-	NE::ListValuePtr result (new NE::ListValue ());
-	BI::CombineValues (this, {x, y}, [&] (const NE::ValueCombination& combination) {
-		result->Push (NE::ValuePtr (new PointValue (
+	std::vector<NE::ValueConstPtr> result;
+	bool isValid = BI::CombineValuesParallel (this, {x, y}, [&] (const NE::ValueCombination& combination) {
+		return NE::CreateValue<PointValue> (
 			Point (
 				NE::NumberValue::ToDouble (combination.GetValue (0)),
 				NE::NumberValue::ToDouble (combination.GetValue (1))
 			)
-		)));
-		return true;
-	});
+		);
+	}, result);
 
-	return result;
+	if (!isValid) {
+		return nullptr;
+	}
+	return NE::ValuePtr (new NE::ListValue (result));
 }
 
 void PointNode::RegisterParameters (NUIE::NodeParameterList& parameterList) const
@@ -341,19 +350,21 @@ NE::ValueConstPtr LineNode::Calculate (NE::EvaluationEnv& env) const
 		return nullptr;
 	}
 
-	NE::ListValuePtr result (new NE::ListValue ());
-	BI::CombineValues (this, {beg, end, color}, [&] (const NE::ValueCombination& combination) {
-		result->Push (NE::ValuePtr (new LineValue (
+	std::vector<NE::ValueConstPtr> result;
+	bool isValid = BI::CombineValuesParallel (this, {beg, end, color}, [&] (const NE::ValueCombination& combination) {
+		return NE::CreateValue<LineValue> (
 			Line (
 				PointValue::Get (combination.GetValue (0)),
 				PointValue::Get (combination.GetValue (1)),
 				ColorValue::Get (combination.GetValue (2))
 			)
-		)));
-		return true;
-	});
+		);
+	}, result);
 
-	return result;
+	if (!isValid) {
+		return nullptr;
+	}
+	return NE::ValuePtr (new NE::ListValue (result));
 }
 
 NE::Stream::Status LineNode::Read (NE::InputStream& inputStream)
@@ -400,19 +411,21 @@ NE::ValueConstPtr CircleNode::Calculate (NE::EvaluationEnv& env) const
 		return nullptr;
 	}
 
-	NE::ListValuePtr result (new NE::ListValue ());
-	BI::CombineValues (this, {beg, end, color}, [&] (const NE::ValueCombination& combination) {
-		result->Push (NE::ValuePtr (new CircleValue (
+	std::vector<NE::ValueConstPtr> result;
+	bool isValid = BI::CombineValuesParallel (this, {beg, end, color}, [&] (const NE::ValueCombination& combination) {
+		return NE::CreateValue<CircleValue> (
 			Circle (
 				PointValue::Get (combination.GetValue (0)),
 				NE::NumberValue::ToDouble (combination.GetValue (1)),
 				ColorValue::Get (combination.GetValue (2))
 			)
-		)));
-		return true;
-	});
+		);
+	}, result);
 
-	return result;
+	if (!isValid) {
+		return nullptr;
+	}
+	return NE::ValuePtr (new NE::ListValue (result));
 }
 
 void CircleNode::RegisterParameters (NUIE::NodeParameterList& parameterList) const
@@ -34,6 +34,7 @@ public:
 	virtual void				Initialize () override;
 	virtual void				RegisterParameters (NUIE::NodeParameterList& parameterList) const override;
 	virtual void				ProcessCalculatedValue (const NE::ValueConstPtr& value, NE::EvaluationEnv& env) const override;
+	virtual bool				IsThreadSafe () const override;
 	virtual void				OnFeatureChange (const NUIE::FeatureId& featureId, NE::EvaluationEnv& env) const override;
 	virtual void				OnDelete (NE::EvaluationEnv& env) const override;
 